@@ -10,12 +10,16 @@
 
 # include <boost/python/args.hpp>
 # include <boost/python/args_fwd.hpp>
+# include <boost/python/attribute_name.hpp>
 # include <boost/python/back_reference.hpp>
 # include <boost/python/bases.hpp>
 # include <boost/python/borrowed.hpp>
+# include <boost/python/buffer_view.hpp>
+# include <boost/python/cache_by_address.hpp>
 # include <boost/python/call.hpp>
 # include <boost/python/call_method.hpp>
 # include <boost/python/class.hpp>
+# include <boost/python/compact_instance.hpp>
 # include <boost/python/copy_const_reference.hpp>
 # include <boost/python/copy_non_const_reference.hpp>
 # include <boost/python/data_members.hpp>
@@ -23,6 +27,7 @@
 # include <boost/python/default_call_policies.hpp>
 # include <boost/python/dict.hpp>
 # include <boost/python/docstring_options.hpp>
+# include <boost/python/ensure_gil.hpp>
 # include <boost/python/enum.hpp>
 # include <boost/python/errors.hpp>
 # include <boost/python/exception_translator.hpp>
@@ -51,11 +56,13 @@
 # include <boost/python/other.hpp>
 # include <boost/python/overloads.hpp>
 # include <boost/python/pointee.hpp>
+# include <boost/python/pooled_instances.hpp>
 # include <boost/python/pure_virtual.hpp>
 # include <boost/python/ptr.hpp>
 # include <boost/python/raw_function.hpp>
 # include <boost/python/reference_existing_object.hpp>
 # include <boost/python/register_ptr_to_python.hpp>
+# include <boost/python/release_gil.hpp>
 # include <boost/python/return_arg.hpp>
 # include <boost/python/return_internal_reference.hpp>
 # include <boost/python/return_opaque_pointer.hpp>
@@ -0,0 +1,73 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef ATTRIBUTE_NAME_HPP
+# define ATTRIBUTE_NAME_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+namespace boost { namespace python {
+
+namespace api
+{
+  // The name of an attribute, interned as a Python string the first
+  // time it's used and kept for the life of the process. Unlike a
+  // char const*, it doesn't have to be converted and hashed again on
+  // every access. Declare one with BOOST_PYTHON_ATTRIBUTE_NAME(id),
+  // then pass id to object::attr(), getattr(), setattr(), delattr()
+  // or call_method<>() in place of "id".
+  //
+  // This is an aggregate so that it is initialized statically; its
+  // members are an implementation detail.
+  struct attribute_name
+  {
+      char const* c_str() const { return m_name; }
+
+      // Returns a borrowed reference to the interned string. The
+      // GIL must be held.
+      PyObject* get() const
+      {
+          return m_object != 0 ? m_object : this->intern();
+      }
+
+      BOOST_PYTHON_DECL PyObject* intern() const;
+
+      char const* m_name;
+      mutable PyObject* m_object;
+  };
+}
+
+using api::attribute_name;
+
+namespace detail
+{
+  // The name of the method passed to call_method<>(): either an
+  // attribute_name or a plain string.
+  class method_name
+  {
+   public:
+      method_name(char const* name)
+        : m_name(name), m_attribute(0) {}
+
+      method_name(attribute_name const& name)
+        : m_name(name.c_str()), m_attribute(&name) {}
+
+      char const* c_str() const { return m_name; }
+
+      // The interned name, or 0 if there is none
+      attribute_name const* attribute() const { return m_attribute; }
+
+   private:
+      char const* m_name;
+      attribute_name const* m_attribute;
+  };
+}
+
+}} // namespace boost::python
+
+// Declares id, an attribute_name for the Python identifier of the same
+// spelling. It may be used at namespace or block scope.
+# define BOOST_PYTHON_ATTRIBUTE_NAME(id) \
+    static ::boost::python::attribute_name const id = { #id, 0 }
+
+#endif // ATTRIBUTE_NAME_HPP
@@ -0,0 +1,102 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BUFFER_VIEW_HPP
+# define BUFFER_VIEW_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/converter/buffer_from_python.hpp>
+# include <boost/type_traits/remove_cv.hpp>
+# include <cstddef>
+
+namespace boost { namespace python {
+
+// A view of the elements of a Python object which exports the buffer
+// protocol with a matching element type, such as a bytearray,
+// array.array, memoryview or NumPy array. The elements must be
+// contiguous. A buffer_view<T const> accepts read-only buffers, while
+// a buffer_view<T> requires a writable one.
+//
+// Converted as a function argument, the view holds the buffer until
+// the call returns. Copies of it don't, and are only valid as long as
+// the original is.
+template <class T>
+class buffer_view
+{
+ public:
+    typedef T value_type;
+    typedef T* iterator;
+    typedef T* pointer;
+    typedef T& reference;
+    typedef std::size_t size_type;
+
+    buffer_view()
+        : m_data(0), m_size(0), m_owns_buffer(false)
+    {}
+
+    buffer_view(T* data, size_type size)
+        : m_data(data), m_size(size), m_owns_buffer(false)
+    {}
+
+    buffer_view(buffer_view const& rhs)
+        : m_data(rhs.m_data), m_size(rhs.m_size), m_owns_buffer(false)
+    {}
+
+    buffer_view& operator=(buffer_view const& rhs)
+    {
+        if (this != &rhs)
+        {
+            this->release();
+            m_data = rhs.m_data;
+            m_size = rhs.m_size;
+        }
+        return *this;
+    }
+
+    ~buffer_view()
+    {
+        this->release();
+    }
+
+    T* data() const { return m_data; }
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator begin() const { return m_data; }
+    iterator end() const { return m_data + m_size; }
+
+    T& operator[](size_type i) const { return m_data[i]; }
+
+ private:
+    void release()
+    {
+        if (m_owns_buffer)
+        {
+            PyBuffer_Release(&m_buffer);
+            m_owns_buffer = false;
+        }
+    }
+
+    template <class U> friend struct converter::buffer_view_from_python;
+
+    T* m_data;
+    size_type m_size;
+    bool m_owns_buffer;
+    Py_buffer m_buffer;
+};
+
+// Registers from_python conversions from buffers of T to
+// buffer_view<T const>, buffer_view<T> and, by copying the
+// elements, to std::vector<T>.
+template <class T>
+void register_buffer_from_python(BOOST_EXPLICIT_TEMPLATE_TYPE(T))
+{
+    converter::buffer_view_from_python<T const>();
+    converter::buffer_view_from_python<T>();
+    converter::vector_from_buffer<T>();
+}
+
+}} // namespace boost::python
+
+#endif // BUFFER_VIEW_HPP
@@ -0,0 +1,131 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef CACHE_BY_ADDRESS_HPP
+# define CACHE_BY_ADDRESS_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/reference_existing_object.hpp>
+# include <boost/python/return_opaque_pointer.hpp>
+# include <boost/python/object/address_cache.hpp>
+# include <boost/python/object/pointer_holder.hpp>
+# include <boost/python/object/make_ptr_instance.hpp>
+# include <boost/python/detail/none.hpp>
+
+# include <boost/type_traits/remove_cv.hpp>
+# include <boost/type_traits/remove_pointer.hpp>
+
+namespace boost { namespace python { 
+
+namespace objects
+{
+  // A pointer_holder which removes its instance from the address
+  // cache when it is destroyed.
+  template <class T>
+  class cached_pointer_holder : public pointer_holder<T*, T>
+  {
+   public:
+      cached_pointer_holder(T* p)
+        : pointer_holder<T*, T>(p), m_address(p)
+      {}
+
+      ~cached_pointer_holder()
+      {
+          registered_address_cache<cached_pointer_holder>::cache.erase(m_address);
+      }
+
+   private:
+      void const* m_address;
+  };
+}
+
+namespace detail
+{
+  struct make_cached_reference_holder
+  {
+      template <class T>
+      static PyObject* execute(T* p)
+      {
+          typedef objects::cached_pointer_holder<T> holder_t;
+          objects::address_cache& cache
+              = objects::registered_address_cache<holder_t>::cache;
+
+          if (PyObject* x = cache.find(p))
+              return x;
+
+          T* q = const_cast<T*>(p);
+          PyObject* x = objects::make_ptr_instance<T, holder_t>::execute(q);
+          if (x != 0 && x != Py_None)
+              cache.insert(p, x);
+          return x;
+      }
+  };
+}
+
+// cache_by_address<G> -- a ResultConverterGenerator which converts
+// pointers and references as G does, except that while the Python
+// object created for an address is alive, returning the same address
+// again yields that object rather than a new one. This preserves
+// identity and any attributes set on the object from Python.
+//
+// The class of a cached object is that of the C++ object for which it
+// was created, so the C++ object must outlive it, as usual with
+// reference_existing_object. G may be reference_existing_object or
+// return_opaque_pointer.
+template <class ResultConverterGenerator>
+struct cache_by_address;
+
+template <>
+struct cache_by_address<reference_existing_object>
+{
+    template <class T>
+    struct apply
+    {
+        BOOST_STATIC_CONSTANT(
+            bool, ok = is_pointer<T>::value || is_reference<T>::value);
+        
+        typedef typename mpl::if_c<
+            ok
+            , to_python_indirect<T, detail::make_cached_reference_holder>
+            , detail::reference_existing_object_requires_a_pointer_or_reference_return_type<T>
+        >::type type;
+    };
+};
+
+template <>
+struct cache_by_address<return_opaque_pointer>
+{
+    template <class R>
+    struct apply
+    {
+        typedef typename return_opaque_pointer::apply<R>::type base;
+        typedef typename remove_cv<
+            typename remove_pointer<R>::type
+        >::type pointee;
+
+        struct type : base
+        {
+            PyObject* operator()(R x) const
+            {
+                if (x == 0)
+                    return python::detail::none();
+
+                objects::address_cache& cache
+                    = objects::registered_address_cache<opaque<pointee> >::cache;
+
+                if (PyObject* result = cache.find(x))
+                    return result;
+
+                PyObject* result = base::operator()(x);
+                if (result != 0)
+                    cache.insert(x, result);
+                return result;
+            }
+        };
+    };
+};
+
+}} // namespace boost::python
+
+#endif // CACHE_BY_ADDRESS_HPP
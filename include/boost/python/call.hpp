@@ -16,6 +16,7 @@
 #  include <boost/python/converter/return_from_python.hpp>
 #  include <boost/python/detail/preprocessor.hpp>
 #  include <boost/python/detail/void_return.hpp>
+#  include <boost/python/detail/vectorcall.hpp>
 
 #  include <boost/preprocessor/comma_if.hpp>
 #  include <boost/preprocessor/iterate.hpp>
@@ -59,12 +60,23 @@ call(PyObject* callable
     , boost::type<R>* = 0
     )
 {
+# ifdef BOOST_PYTHON_HAS_VECTORCALL
+    PyObject* result;
+    {
+        BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_ARG_TO_PYTHON_LOCAL, nil)
+        PyObject* args[N + 1] = {
+            0 BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_ARG_TO_PYTHON_LOCAL_GET, nil)
+        };
+        result = detail::vectorcall(callable, args, N);
+    }
+# else
     PyObject* const result = 
         PyEval_CallFunction(
             callable
             , const_cast<char*>("(" BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_FIXED, "O") ")")
             BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_FAST_ARG_TO_PYTHON_GET, nil)
             );
+# endif
     
     // This conversion *must not* be done in the same expression as
     // the call, because, in the special case where the result is a
@@ -11,10 +11,12 @@
 
 #  include <boost/type.hpp>
 
+#  include <boost/python/attribute_name.hpp>
 #  include <boost/python/converter/arg_to_python.hpp>
 #  include <boost/python/converter/return_from_python.hpp>
 #  include <boost/python/detail/preprocessor.hpp>
 #  include <boost/python/detail/void_return.hpp>
+#  include <boost/python/detail/vectorcall.hpp>
 
 #  include <boost/preprocessor/comma_if.hpp>
 #  include <boost/preprocessor/iterate.hpp>
@@ -53,18 +55,29 @@ template <
     BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class A)
     >
 typename detail::returnable<R>::type
-call_method(PyObject* self, char const* name
+call_method(PyObject* self, detail::method_name const& name
     BOOST_PP_COMMA_IF(N) BOOST_PP_ENUM_BINARY_PARAMS_Z(1, N, A, const& a)
     , boost::type<R>* = 0
     )
 {
+# ifdef BOOST_PYTHON_HAS_VECTORCALL
+    PyObject* result;
+    {
+        BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_ARG_TO_PYTHON_LOCAL, nil)
+        PyObject* args[N + 1] = {
+            self BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_ARG_TO_PYTHON_LOCAL_GET, nil)
+        };
+        result = detail::vectorcall_method(name, args, N);
+    }
+# else
     PyObject* const result = 
         PyEval_CallMethod(
             self
-            , const_cast<char*>(name)
+            , const_cast<char*>(name.c_str())
             , const_cast<char*>("(" BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_FIXED, "O") ")")
             BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_FAST_ARG_TO_PYTHON_GET, nil)
             );
+# endif
     
     // This conversion *must not* be done in the same expression as
     // the call, because, in the special case where the result is a
@@ -23,6 +23,7 @@
 # include <boost/python/object/class_metadata.hpp>
 # include <boost/python/object/pickle_support.hpp>
 # include <boost/python/object/add_to_namespace.hpp>
+# include <boost/python/object/data_member.hpp>
 
 # include <boost/python/detail/overloads_fwd.hpp>
 # include <boost/python/detail/operator_id.hpp>
@@ -31,6 +32,7 @@
 # include <boost/python/detail/unwrap_type_id.hpp>
 # include <boost/python/detail/unwrap_wrapper.hpp>
 
+# include <boost/type_traits/is_arithmetic.hpp>
 # include <boost/type_traits/is_same.hpp>
 # include <boost/type_traits/is_member_function_pointer.hpp>
 # include <boost/type_traits/is_polymorphic.hpp>
@@ -467,15 +469,59 @@ class class_ : public objects::class_base
     self& def_readonly_impl(
         char const* name, D B::*pm_, char const* doc BOOST_PYTHON_YES_DATA_MEMBER)
     {
-        return this->add_property(name, pm_, doc);
+        return this->def_readonly_member(
+            detail::unwrap_wrapper((W*)0), name, pm_, doc, is_arithmetic<D>());
     }
 
     template <class D, class B>
     self& def_readwrite_impl(
         char const* name, D B::*pm_, char const* doc BOOST_PYTHON_YES_DATA_MEMBER)
+    {
+        return this->def_readwrite_member(
+            detail::unwrap_wrapper((W*)0), name, pm_, doc, is_arithmetic<D>());
+    }
+
+    //
+    // Arithmetic data members are accessed through a dedicated
+    // descriptor; all others through a property.
+    //
+    // @group def_readonly_member/def_readwrite_member {
+    template <class T, class D, class B>
+    self& def_readonly_member(T*, char const* name, D B::*pm_, char const* doc, mpl::true_)
+    {
+        D T::*pm = pm_;
+        this->setattr(
+            name
+          , objects::make_data_member(
+                type_id<T>(), objects::data_member_offset(pm)
+              , &objects::get_data_member<D>, 0, doc));
+        return *this;
+    }
+
+    template <class T, class D, class B>
+    self& def_readwrite_member(T*, char const* name, D B::*pm_, char const* doc, mpl::true_)
+    {
+        D T::*pm = pm_;
+        this->setattr(
+            name
+          , objects::make_data_member(
+                type_id<T>(), objects::data_member_offset(pm)
+              , &objects::get_data_member<D>, &objects::set_data_member<D>, doc));
+        return *this;
+    }
+
+    template <class T, class D, class B>
+    self& def_readonly_member(T*, char const* name, D B::*pm_, char const* doc, mpl::false_)
+    {
+        return this->add_property(name, pm_, doc);
+    }
+
+    template <class T, class D, class B>
+    self& def_readwrite_member(T*, char const* name, D B::*pm_, char const* doc, mpl::false_)
     {
         return this->add_property(name, pm_, pm_, doc);
     }
+    // }
 
     template <class D>
     self& def_readonly_impl(
@@ -0,0 +1,38 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef COMPACT_INSTANCE_HPP
+# define COMPACT_INSTANCE_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/def_visitor.hpp>
+
+namespace boost { namespace python {
+
+// Passed to class_<>::def(), leaves the __dict__ and __weakref__
+// slots out of the class' instances, which then can't be given new
+// attributes or be weakly referenced; with_custodian_and_ward and
+// friends raise TypeError when asked to tie another object's
+// lifetime to one. In exchange, each instance is two pointers
+// smaller, and isn't tracked by the cyclic garbage collector.
+//
+// Apply it before any instances of the class exist, and before
+// wrapping classes derived from it, which are compact as well, as
+// are classes derived from it in Python. The bases of a compact class
+// must be compact too.
+class compact_instance : public def_visitor<compact_instance>
+{
+ private:
+    friend class def_visitor_access;
+
+    template <class classT>
+    void visit(classT& c) const
+    {
+        c.make_instances_compact_();
+    }
+};
+
+}} // namespace boost::python
+
+#endif // COMPACT_INSTANCE_HPP
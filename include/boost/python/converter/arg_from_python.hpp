@@ -311,7 +311,12 @@ inline typename arg_rvalue_from_python<T>::result_type
 arg_rvalue_from_python<T>::operator()()
 {
     if (m_data.stage1.construct != 0)
+    {
         m_data.stage1.construct(m_source, &m_data.stage1);
+        
+        // Construct only once, in case the result is asked for again
+        m_data.stage1.construct = 0;
+    }
     
     return python::detail::void_ptr_to_reference(m_data.stage1.convertible, (result_type(*)())0);
 }
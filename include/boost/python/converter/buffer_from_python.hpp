@@ -0,0 +1,169 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BUFFER_FROM_PYTHON_HPP
+# define BUFFER_FROM_PYTHON_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/type_id.hpp>
+# include <boost/python/errors.hpp>
+# include <boost/python/converter/registry.hpp>
+# include <boost/python/converter/registrations.hpp>
+# include <boost/python/converter/rvalue_from_python_data.hpp>
+
+# include <boost/mpl/char.hpp>
+# include <boost/static_assert.hpp>
+# include <boost/type_traits/is_arithmetic.hpp>
+# include <boost/type_traits/is_floating_point.hpp>
+# include <boost/type_traits/is_same.hpp>
+# include <boost/type_traits/is_signed.hpp>
+# include <boost/type_traits/remove_cv.hpp>
+
+# include <cstddef>
+# include <vector>
+
+namespace boost { namespace python {
+
+template <class T> class buffer_view;
+
+namespace converter {
+
+// The kind of element T is, as understood by buffer_format_matches():
+// 'f' for floating point, 'i' for signed and 'u' for unsigned
+// integers, '?' for bool, and 'c' for char, whose signedness varies.
+template <class T>
+struct buffer_element_kind
+  : mpl::char_<
+        is_same<T,bool>::value ? '?'
+      : is_same<T,char>::value ? 'c'
+      : is_floating_point<T>::value ? 'f'
+      : is_signed<T>::value ? 'i'
+      : 'u'
+    >
+{
+    BOOST_STATIC_ASSERT(is_arithmetic<T>::value);
+};
+
+// Returns true iff the elements of a buffer with the given struct
+// module format string and item size are of the given kind and size.
+BOOST_PYTHON_DECL bool buffer_format_matches(
+    char const* format, Py_ssize_t itemsize, char kind, std::size_t size);
+
+// Acquires a C-contiguous buffer from source whose elements are of
+// the given kind and size, and writable if so requested. Returns
+// false, with no Python error set, if source can't provide one.
+BOOST_PYTHON_DECL bool get_buffer(
+    PyObject* source, Py_buffer* view, bool writable, char kind, std::size_t size);
+
+// Registers a from_python converter to buffer_view<T>. T may be
+// const-qualified, in which case read-only buffers are accepted.
+template <class T>
+struct buffer_view_from_python
+{
+    typedef typename remove_cv<T>::type element;
+
+    buffer_view_from_python()
+    {
+        registration const* r = registry::query(type_id<buffer_view<T> >());
+        if (r == 0 || r->rvalue_chain == 0)
+            registry::insert(&convertible, &construct, type_id<buffer_view<T> >());
+    }
+
+ private:
+    static bool acquire(PyObject* source, Py_buffer* view)
+    {
+        return get_buffer(
+            source, view, is_same<T,element>::value
+          , buffer_element_kind<element>::value, sizeof(element));
+    }
+
+    static void* convertible(PyObject* source)
+    {
+        Py_buffer view;
+        if (!acquire(source, &view))
+            return 0;
+        PyBuffer_Release(&view);
+        return source;
+    }
+
+    static void construct(PyObject* source, rvalue_from_python_stage1_data* data)
+    {
+        void* storage = ((rvalue_from_python_storage<buffer_view<T> >*)data)->storage.bytes;
+        buffer_view<T>* result = new (storage) buffer_view<T>();
+
+        if (!acquire(source, &result->m_buffer))
+        {
+            result->~buffer_view();
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_TypeError, "object no longer provides a matching buffer");
+            throw_error_already_set();
+        }
+
+        result->m_data = static_cast<T*>(result->m_buffer.buf);
+        result->m_size = result->m_buffer.len / sizeof(element);
+        result->m_owns_buffer = true;
+
+        // record successful construction
+        data->convertible = storage;
+    }
+};
+
+// Registers a from_python converter which copies the elements of a
+// buffer into a std::vector<T>.
+template <class T>
+struct vector_from_buffer
+{
+    vector_from_buffer()
+    {
+        registration const* r = registry::query(type_id<std::vector<T> >());
+        if (r == 0 || r->rvalue_chain == 0)
+            registry::insert(&convertible, &construct, type_id<std::vector<T> >());
+    }
+
+ private:
+    static bool acquire(PyObject* source, Py_buffer* view)
+    {
+        return get_buffer(source, view, false, buffer_element_kind<T>::value, sizeof(T));
+    }
+
+    static void* convertible(PyObject* source)
+    {
+        Py_buffer view;
+        if (!acquire(source, &view))
+            return 0;
+        PyBuffer_Release(&view);
+        return source;
+    }
+
+    static void construct(PyObject* source, rvalue_from_python_stage1_data* data)
+    {
+        Py_buffer view;
+        if (!acquire(source, &view))
+        {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_TypeError, "object no longer provides a matching buffer");
+            throw_error_already_set();
+        }
+
+        void* storage = ((rvalue_from_python_storage<std::vector<T> >*)data)->storage.bytes;
+        T const* first = static_cast<T const*>(view.buf);
+        try
+        {
+            new (storage) std::vector<T>(first, first + view.len / sizeof(T));
+        }
+        catch(...)
+        {
+            PyBuffer_Release(&view);
+            throw;
+        }
+        PyBuffer_Release(&view);
+
+        // record successful construction
+        data->convertible = storage;
+    }
+};
+
+}}} // namespace boost::python::converter
+
+#endif // BUFFER_FROM_PYTHON_HPP
@@ -9,7 +9,11 @@
 # include <boost/python/handle.hpp>
 # include <boost/python/ssize_t.hpp>
 # include <boost/implicit_cast.hpp>
+# include <boost/utility/string_ref.hpp>
 # include <string>
+# ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#  include <string_view>
+# endif
 # include <complex>
 # include <boost/limits.hpp>
 
@@ -156,10 +160,18 @@ BOOST_PYTHON_TO_PYTHON_BY_VALUE(unsigned BOOST_PYTHON_LONG_LONG, ::PyLong_FromUn
 BOOST_PYTHON_TO_PYTHON_BY_VALUE(char, converter::do_return_to_python(x), &PyUnicode_Type)
 BOOST_PYTHON_TO_PYTHON_BY_VALUE(char const*, converter::do_return_to_python(x), &PyUnicode_Type)
 BOOST_PYTHON_TO_PYTHON_BY_VALUE(std::string, ::PyUnicode_FromStringAndSize(x.data(),implicit_cast<ssize_t>(x.size())), &PyUnicode_Type)
+BOOST_PYTHON_TO_PYTHON_BY_VALUE(boost::string_ref, ::PyUnicode_FromStringAndSize(x.data(),implicit_cast<ssize_t>(x.size())), &PyUnicode_Type)
+# ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+BOOST_PYTHON_TO_PYTHON_BY_VALUE(std::string_view, ::PyUnicode_FromStringAndSize(x.data(),implicit_cast<ssize_t>(x.size())), &PyUnicode_Type)
+# endif
 #else
 BOOST_PYTHON_TO_PYTHON_BY_VALUE(char, converter::do_return_to_python(x), &PyString_Type)
 BOOST_PYTHON_TO_PYTHON_BY_VALUE(char const*, converter::do_return_to_python(x), &PyString_Type)
 BOOST_PYTHON_TO_PYTHON_BY_VALUE(std::string, ::PyString_FromStringAndSize(x.data(),implicit_cast<ssize_t>(x.size())), &PyString_Type)
+BOOST_PYTHON_TO_PYTHON_BY_VALUE(boost::string_ref, ::PyString_FromStringAndSize(x.data(),implicit_cast<ssize_t>(x.size())), &PyString_Type)
+# ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+BOOST_PYTHON_TO_PYTHON_BY_VALUE(std::string_view, ::PyString_FromStringAndSize(x.data(),implicit_cast<ssize_t>(x.size())), &PyString_Type)
+# endif
 #endif
 
 #if defined(Py_USING_UNICODE) && !defined(BOOST_NO_STD_WSTRING)
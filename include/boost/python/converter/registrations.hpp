@@ -31,6 +31,12 @@ struct rvalue_from_python_chain
     rvalue_from_python_chain* next;
 };
 
+struct rvalue_from_python_cache_entry
+{
+    PyTypeObject const* source_type;
+    rvalue_from_python_chain const* converter;
+};
+
 struct BOOST_PYTHON_DECL registration
 {
  public: // member functions
@@ -40,6 +46,9 @@ struct BOOST_PYTHON_DECL registration
     // Convert the appropriately-typed data to Python
     PyObject* to_python(void const volatile*) const;
 
+    // Convert a temporary to Python, moving from it if possible
+    PyObject* to_python_move(void*) const;
+
     // Return the class object, or raise an appropriate Python
     // exception if no class has been registered.
     PyTypeObject* get_class_object() const;
@@ -49,6 +58,10 @@ struct BOOST_PYTHON_DECL registration
     PyTypeObject const* expected_from_python_type() const;
     PyTypeObject const* to_python_target_type() const;
 
+    // Forget which rvalue converters succeeded for which source
+    // types. Must be called whenever rvalue_chain changes.
+    void clear_rvalue_cache();
+
  public: // data members. So sue me.
     const python::type_info target_type;
 
@@ -57,6 +70,13 @@ struct BOOST_PYTHON_DECL registration
 
     // The chain of eligible from_python converters when an rvalue is acceptable
     rvalue_from_python_chain* rvalue_chain;
+
+    // The rvalue_chain entries which most recently succeeded, keyed on
+    // the Python type of the source object. Only used when
+    // rvalue_chain has more than one entry.
+    enum { rvalue_cache_size = 4 };
+    mutable rvalue_from_python_cache_entry m_rvalue_cache[rvalue_cache_size];
+    mutable unsigned m_rvalue_cache_next;
     
     // The class object associated with this type
     PyTypeObject* m_class_object;
@@ -65,6 +85,10 @@ struct BOOST_PYTHON_DECL registration
     to_python_function_t m_to_python;
     PyTypeObject const* (*m_to_python_target_type)();
 
+    // Like m_to_python, but may move from the data it converts. Null
+    // unless the type was exposed with class_.
+    to_python_function_t m_to_python_move;
+
 
     // True iff this type is a shared_ptr.  Needed for special rvalue
     // from_python handling.
@@ -86,8 +110,21 @@ inline registration::registration(type_info target_type, bool is_shared_ptr)
       , m_class_object(0)
       , m_to_python(0)
       , m_to_python_target_type(0)
+      , m_to_python_move(0)
       , is_shared_ptr(is_shared_ptr)
-{}
+{
+    this->clear_rvalue_cache();
+}
+
+inline void registration::clear_rvalue_cache()
+{
+    for (unsigned i = 0; i < rvalue_cache_size; ++i)
+    {
+        m_rvalue_cache[i].source_type = 0;
+        m_rvalue_cache[i].converter = 0;
+    }
+    m_rvalue_cache_next = 0;
+}
 
 inline bool operator<(registration const& lhs, registration const& rhs)
 {
@@ -29,6 +29,10 @@ namespace registry
   
   BOOST_PYTHON_DECL void insert(to_python_function_t, type_info, PyTypeObject const* (*to_python_target_type)() = 0);
 
+  // Insert a to_python converter which may move from its argument,
+  // used for temporaries in preference to the one above.
+  BOOST_PYTHON_DECL void insert_move(to_python_function_t, type_info);
+
   // Insert an lvalue from_python converter
   BOOST_PYTHON_DECL void insert(convertible_function, type_info, PyTypeObject const* (*expected_pytype)() = 0);
 
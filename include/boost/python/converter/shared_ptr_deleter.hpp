@@ -5,6 +5,12 @@
 #ifndef SHARED_PTR_DELETER_DWA2002121_HPP
 # define SHARED_PTR_DELETER_DWA2002121_HPP
 
+# include <boost/python/handle.hpp>
+# include <boost/shared_ptr.hpp>
+# ifndef BOOST_NO_CXX11_SMART_PTR
+#  include <memory>
+# endif
+
 namespace boost { namespace python { namespace converter { 
 
 struct BOOST_PYTHON_DECL shared_ptr_deleter
@@ -17,6 +23,15 @@ struct BOOST_PYTHON_DECL shared_ptr_deleter
     handle<> owner;
 };
 
+// Sets result to a null pointer whose deleter is a shared_ptr_deleter
+// for owner. As long as one such pointer is alive, the same control
+// block is returned for owner, so that passing an object to many
+// shared_ptr parameters allocates it only once.
+BOOST_PYTHON_DECL void get_shared_owner(PyObject* owner, boost::shared_ptr<void>& result);
+# ifndef BOOST_NO_CXX11_SMART_PTR
+BOOST_PYTHON_DECL void get_shared_owner(PyObject* owner, std::shared_ptr<void>& result);
+# endif
+
 }}} // namespace boost::python::converter
 
 #endif // SHARED_PTR_DELETER_DWA2002121_HPP
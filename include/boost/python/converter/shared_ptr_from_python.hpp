@@ -14,15 +14,22 @@
 # include <boost/python/converter/pytype_function.hpp>
 #endif
 # include <boost/shared_ptr.hpp>
+# ifndef BOOST_NO_CXX11_SMART_PTR
+#  include <memory>
+# endif
 
 namespace boost { namespace python { namespace converter { 
 
-template <class T>
+// Registers a from_python converter to SP<T>, which may be
+// boost::shared_ptr or std::shared_ptr. The result keeps the source
+// object alive through a control block shared with other results
+// converted from the same object; see get_shared_owner().
+template <class T, template <class> class SP = boost::shared_ptr>
 struct shared_ptr_from_python
 {
     shared_ptr_from_python()
     {
-        converter::registry::insert(&convertible, &construct, type_id<shared_ptr<T> >()
+        converter::registry::insert(&convertible, &construct, type_id<SP<T> >()
 #ifndef BOOST_PYTHON_NO_PY_SIGNATURES
                       , &converter::expected_from_python_type_direct<T>::get_pytype
 #endif
@@ -40,16 +47,16 @@ struct shared_ptr_from_python
     
     static void construct(PyObject* source, rvalue_from_python_stage1_data* data)
     {
-        void* const storage = ((converter::rvalue_from_python_storage<shared_ptr<T> >*)data)->storage.bytes;
+        void* const storage = ((converter::rvalue_from_python_storage<SP<T> >*)data)->storage.bytes;
         // Deal with the "None" case.
         if (data->convertible == source)
-            new (storage) shared_ptr<T>();
+            new (storage) SP<T>();
         else
         {
-            boost::shared_ptr<void> hold_convertible_ref_count(
-              (void*)0, shared_ptr_deleter(handle<>(borrowed(source))) );
+            SP<void> hold_convertible_ref_count;
+            get_shared_owner(source, hold_convertible_ref_count);
             // use aliasing constructor
-            new (storage) shared_ptr<T>(
+            new (storage) SP<T>(
                 hold_convertible_ref_count,
                 static_cast<T*>(data->convertible));
         }
@@ -14,6 +14,7 @@
 #  include <boost/detail/indirect_traits.hpp>
 
 #  include <boost/python/detail/invoke.hpp>
+#  include <boost/python/detail/gil_guard.hpp>
 #  include <boost/python/detail/signature.hpp>
 #  include <boost/python/detail/preprocessor.hpp>
 
@@ -27,6 +28,7 @@
 #  include <boost/preprocessor/if.hpp>
 #  include <boost/preprocessor/iteration/local.hpp>
 #  include <boost/preprocessor/repetition/enum_trailing_params.hpp>
+#  include <boost/preprocessor/repetition/enum_trailing_binary_params.hpp>
 #  include <boost/preprocessor/repetition/repeat.hpp>
 
 #  include <boost/compressed_pair.hpp>
@@ -55,6 +57,60 @@ inline unsigned arity(PyObject* const& args_)
     return PyTuple_GET_SIZE(args_);
 }
 
+// The arguments of a vectorcall: a borrowed array of positional
+// arguments which stands in for the argument tuple.
+struct vector_args
+{
+    vector_args(PyObject* const* argv_, unsigned nargs_)
+        : argv(argv_), nargs(nargs_) {}
+    
+    PyObject* const* argv;
+    unsigned nargs;
+};
+
+template <int N>
+inline PyObject* get(mpl::int_<N>, vector_args const& args_)
+{
+    return args_.argv[N];
+}
+
+inline unsigned arity(vector_args const& args_)
+{
+    return args_.nargs;
+}
+
+// Builds a new argument tuple from a vector_args, for the callers
+// which can only deal with tuples.
+inline PyObject* make_args_tuple(vector_args const& args_)
+{
+    PyObject* result = PyTuple_New(args_.nargs);
+    if (result != 0)
+    {
+        for (unsigned i = 0; i < args_.nargs; ++i)
+        {
+            Py_INCREF(args_.argv[i]);
+            PyTuple_SET_ITEM(result, i, args_.argv[i]);
+        }
+    }
+    return result;
+}
+
+// Given the argument_package of a model of CallPolicies, this
+// metafunction yields the package to use when the arguments arrive as
+// a vector_args instead of a tuple, or void if the policies can only
+// be applied to an argument tuple.
+template <class ArgumentPackage>
+struct vector_argument_package
+{
+    typedef void type;
+};
+
+template <>
+struct vector_argument_package<PyObject*>
+{
+    typedef vector_args type;
+};
+
 // This "result converter" is really just used as
 // a dispatch tag to invoke(...), selecting the appropriate
 // implementation
@@ -129,10 +185,14 @@ struct caller;
      if (!c##n.convertible())                                                   \
           return 0;
 
+#  define BOOST_PYTHON_COMPLETE_ARG_CONVERSION(n)                               \
+     (void)ac##n();
+
 #  define BOOST_PP_ITERATION_PARAMS_1                                            \
         (3, (0, BOOST_PYTHON_MAX_ARITY + 1, <boost/python/detail/caller.hpp>))
 #  include BOOST_PP_ITERATE()
 
+#  undef BOOST_PYTHON_COMPLETE_ARG_CONVERSION
 #  undef BOOST_PYTHON_ARG_CONVERTER
 #  undef BOOST_PYTHON_NEXT
 
@@ -198,31 +258,18 @@ struct caller_arity<N>
                                                          // trailing
                                                          // keyword dict
         {
-            typedef typename mpl::begin<Sig>::type first;
-            typedef typename first::type result_t;
-            typedef typename select_result_converter<Policies, result_t>::type result_converter;
-            typedef typename Policies::argument_package argument_package;
-            
-            argument_package inner_args(args_);
-
-# if N
-#  define BOOST_PP_LOCAL_MACRO(i) BOOST_PYTHON_ARG_CONVERTER(i)
-#  define BOOST_PP_LOCAL_LIMITS (0, N-1)
-#  include BOOST_PP_LOCAL_ITERATE()
-# endif 
-            // all converters have been checked. Now we can do the
-            // precall part of the policy
-            if (!m_data.second().precall(inner_args))
-                return 0;
+            return this->call_(args_, (typename Policies::argument_package*)0);
+        }
 
-            PyObject* result = detail::invoke(
-                detail::invoke_tag<result_t,F>()
-              , create_result_converter(args_, (result_converter*)0, (result_converter*)0)
-              , m_data.first()
-                BOOST_PP_ENUM_TRAILING_PARAMS(N, c)
-            );
+        // The vectorcall entry point: the arguments are read straight
+        // from argv without building a tuple.
+        PyObject* operator()(PyObject* const* argv, unsigned nargs)
+        {
+            typedef typename vector_argument_package<
+                typename Policies::argument_package
+            >::type vector_package;
             
-            return m_data.second().postcall(inner_args, result);
+            return this->call_(vector_args(argv, nargs), (vector_package*)0);
         }
 
         static unsigned min_arity() { return N; }
@@ -248,6 +295,81 @@ struct caller_arity<N>
             return  res;
         }
      private:
+        // These policies can't be applied to a vector_args; fall back
+        // to an argument tuple.
+        PyObject* call_(vector_args const& args_, void*)
+        {
+            handle<> inner_args(allow_null(make_args_tuple(args_)));
+            return inner_args ? (*this)(inner_args.get(), 0) : 0;
+        }
+        
+        template <class Args, class ArgumentPackage>
+        PyObject* call_(Args const& args_, ArgumentPackage*)
+        {
+            typedef typename mpl::begin<Sig>::type first;
+            typedef typename first::type result_t;
+            typedef typename select_result_converter<Policies, result_t>::type result_converter;
+            typedef ArgumentPackage argument_package;
+            
+            argument_package inner_args(args_);
+
+# if N
+#  define BOOST_PP_LOCAL_MACRO(i) BOOST_PYTHON_ARG_CONVERTER(i)
+#  define BOOST_PP_LOCAL_LIMITS (0, N-1)
+#  include BOOST_PP_LOCAL_ITERATE()
+# endif 
+            // all converters have been checked. Now we can do the
+            // precall part of the policy
+            if (!m_data.second().precall(inner_args))
+                return 0;
+
+            PyObject* result = this->invoke_(
+                releases_gil<Policies>()
+              , create_result_converter(args_, (result_converter*)0, (result_converter*)0)
+                BOOST_PP_ENUM_TRAILING_PARAMS(N, c)
+            );
+            
+            return m_data.second().postcall(inner_args, result);
+        }
+
+        template <class RC BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class AC)>
+        PyObject* invoke_(
+            mpl::false_, RC const& rc BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, AC, & ac))
+        {
+            typedef typename mpl::begin<Sig>::type::type result_t;
+            
+            return detail::invoke(
+                detail::invoke_tag<result_t,F>()
+              , rc
+              , m_data.first()
+                BOOST_PP_ENUM_TRAILING_PARAMS(N, ac)
+            );
+        }
+
+        // The policies ask for the GIL to be released while the C++
+        // function runs
+        template <class RC BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class AC)>
+        PyObject* invoke_(
+            mpl::true_, RC const& rc BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, AC, & ac))
+        {
+            typedef typename mpl::begin<Sig>::type::type result_t;
+
+            // Complete the argument conversions while the GIL is held
+# if N
+#  define BOOST_PP_LOCAL_MACRO(i) BOOST_PYTHON_COMPLETE_ARG_CONVERSION(i)
+#  define BOOST_PP_LOCAL_LIMITS (0, N-1)
+#  include BOOST_PP_LOCAL_ITERATE()
+# endif 
+            gil_release_guard guard;
+            
+            return detail::invoke(
+                detail::invoke_tag<result_t,F>()
+              , gil_reacquiring_result_converter<RC>(rc, guard)
+              , m_data.first()
+                BOOST_PP_ENUM_TRAILING_PARAMS(N, ac)
+            );
+        }
+
         compressed_pair<F,Policies> m_data;
     };
 };
@@ -0,0 +1,140 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef GIL_GUARD_HPP
+# define GIL_GUARD_HPP
+
+# include <boost/python/detail/prefix.hpp>
+# include <boost/python/detail/none.hpp>
+
+# include <boost/mpl/bool.hpp>
+# include <boost/mpl/eval_if.hpp>
+# include <boost/mpl/has_xxx.hpp>
+# include <boost/mpl/identity.hpp>
+# include <boost/noncopyable.hpp>
+# include <boost/shared_ptr.hpp>
+
+namespace boost { namespace python { namespace detail {
+
+// Releases the GIL on construction. The GIL is reacquired by
+// reacquire() or, at the latest, on destruction.
+struct gil_release_guard : boost::noncopyable
+{
+    gil_release_guard() : m_state(PyEval_SaveThread()) {}
+    ~gil_release_guard() { reacquire(); }
+
+    void reacquire()
+    {
+        if (m_state != 0)
+        {
+            PyEval_RestoreThread(m_state);
+            m_state = 0;
+        }
+    }
+ private:
+    PyThreadState* m_state;
+};
+
+// Makes sure the calling thread holds the GIL for the guard's
+// lifetime, acquiring it only if the thread doesn't already. Guards
+// must be destroyed in the reverse order of their construction.
+struct gil_ensure_guard : boost::noncopyable
+{
+    gil_ensure_guard() : m_state(PyGILState_Ensure()) {}
+    ~gil_ensure_guard() { PyGILState_Release(m_state); }
+ private:
+    PyGILState_STATE m_state;
+};
+
+// Holds the GIL, if enabled, for as long as the guard or any copy of
+// it lives.
+class shared_gil_guard
+{
+ public:
+    explicit shared_gil_guard(bool enabled)
+      : m_guard(enabled ? new gil_ensure_guard : 0)
+    {}
+ private:
+    boost::shared_ptr<gil_ensure_guard> m_guard;
+};
+
+// Stands in for gil_release_guard when the GIL is to be kept.
+struct no_gil_release_guard : boost::noncopyable
+{
+    void reacquire() {}
+};
+
+// A metafunction which is true iff the CallPolicies ask for the GIL
+// to be released around the call of the wrapped C++ function, by
+// declaring a nested releases_gil type (see release_gil.hpp).
+BOOST_MPL_HAS_XXX_TRAIT_DEF(releases_gil)
+
+template <class Policies>
+struct select_releases_gil
+{
+    typedef typename Policies::releases_gil type;
+};
+
+template <class Policies>
+struct releases_gil
+  : mpl::eval_if<
+        has_releases_gil<Policies>
+      , select_releases_gil<Policies>
+      , mpl::identity<mpl::false_>
+    >::type
+{
+};
+
+// CallPolicies which keep the GIL held, even though the Policies they
+// are derived from would have it released. Used where something else
+// takes care of releasing the GIL (see make_holder.hpp).
+template <class Policies>
+struct gil_holding_policies : Policies
+{
+    gil_holding_policies(Policies const& p) : Policies(p) {}
+    typedef mpl::false_ releases_gil;
+};
+
+// Wraps a result converter so that the GIL is reacquired before the
+// result is converted to Python.
+template <class ResultConverter>
+struct gil_reacquiring_result_converter
+{
+    gil_reacquiring_result_converter(ResultConverter const& rc, gil_release_guard& guard)
+      : m_rc(rc), m_guard(guard) {}
+
+    template <class T>
+    PyObject* operator()(T& x) const
+    {
+        m_guard.reacquire();
+        return m_rc(x);
+    }
+
+    template <class T>
+    PyObject* operator()(T const& x) const
+    {
+        m_guard.reacquire();
+        return m_rc(x);
+    }
+
+    void reacquire() const
+    {
+        m_guard.reacquire();
+    }
+
+ private:
+    ResultConverter const& m_rc;
+    gil_release_guard& m_guard;
+};
+
+// Used by invoke() to produce the result of a void function.
+template <class ResultConverter>
+inline PyObject* void_result(gil_reacquiring_result_converter<ResultConverter> const& rc)
+{
+    rc.reacquire();
+    return none();
+}
+
+}}} // namespace boost::python::detail
+
+#endif // GIL_GUARD_HPP
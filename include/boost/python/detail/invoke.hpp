@@ -47,6 +47,13 @@ typedef int void_result_to_python;
 template <bool void_return, bool member>
 struct invoke_tag_ {};
 
+// Produces the result of a void function. Overloads for other
+// "result converters" may be found by argument-dependent lookup.
+inline PyObject* void_result(void_result_to_python)
+{
+    return none();
+}
+
 // A metafunction returning the appropriate tag type for invoking an
 // object of type F with return type R.
 template <class R, class F>
@@ -76,10 +83,10 @@ inline PyObject* invoke(invoke_tag_<false,false>, RC const& rc, F& f BOOST_PP_EN
 }
                  
 template <class RC, class F BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class AC)>
-inline PyObject* invoke(invoke_tag_<true,false>, RC const&, F& f BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, AC, & ac) )
+inline PyObject* invoke(invoke_tag_<true,false>, RC const& rc, F& f BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, AC, & ac) )
 {
     f( BOOST_PP_ENUM_BINARY_PARAMS_Z(1, N, ac, () BOOST_PP_INTERCEPT) );
-    return none();
+    return void_result(rc);
 }
 
 template <class RC, class F, class TC BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class AC)>
@@ -89,10 +96,10 @@ inline PyObject* invoke(invoke_tag_<false,true>, RC const& rc, F& f, TC& tc BOOS
 }
                  
 template <class RC, class F, class TC BOOST_PP_ENUM_TRAILING_PARAMS_Z(1, N, class AC)>
-inline PyObject* invoke(invoke_tag_<true,true>, RC const&, F& f, TC& tc BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, AC, & ac) )
+inline PyObject* invoke(invoke_tag_<true,true>, RC const& rc, F& f, TC& tc BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, AC, & ac) )
 {
     (tc().*f)(BOOST_PP_ENUM_BINARY_PARAMS_Z(1, N, ac, () BOOST_PP_INTERCEPT));
-    return none();
+    return void_result(rc);
 }
 
 # undef N
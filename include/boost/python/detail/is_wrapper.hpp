@@ -5,18 +5,17 @@
 # define IS_WRAPPER_DWA2004723_HPP
 
 # include <boost/python/detail/prefix.hpp>
+# include <boost/python/detail/wrapper_base.hpp>
 # include <boost/mpl/bool.hpp>
 
 namespace boost { namespace python {
 
-template <class T> class wrapper;
-
 namespace detail
 {
   typedef char (&is_not_wrapper)[2];
   is_not_wrapper is_wrapper_helper(...);
-  template <class T>
-  char is_wrapper_helper(wrapper<T> const volatile*);
+  template <class T, gil_mode Mode>
+  char is_wrapper_helper(wrapper<T,Mode> const volatile*);
 
   // A metafunction returning true iff T is [derived from] wrapper<U> 
   template <class T>
@@ -9,8 +9,10 @@
 # include <boost/python/args_fwd.hpp>
 
 # include <boost/python/object/make_holder.hpp>
+# include <boost/python/detail/gil_guard.hpp>
 
 # include <boost/mpl/size.hpp>
+# include <boost/mpl/if.hpp>
 
 
 namespace boost { namespace python { namespace detail { 
@@ -60,10 +62,19 @@ object make_keyword_range_constructor(
 #if !defined( BOOST_PYTHON_NO_PY_SIGNATURES) && defined( BOOST_PYTHON_PY_SIGNATURES_PROPER_INIT_SELF_TYPE)
     python_class<BOOST_DEDUCED_TYPENAME Holder::value_type>::register_();
 #endif
+    // If the policies ask for the GIL to be released, make_holder
+    // releases it only while the C++ object is constructed.
+    typedef typename releases_gil<CallPolicies>::type release_gil_;
+    typedef typename mpl::if_<
+        release_gil_
+      , gil_holding_policies<CallPolicies>
+      , CallPolicies
+    >::type policies_t;
+    
     return detail::make_keyword_range_function(
         objects::make_holder<Arity::value>
-            ::template apply<Holder,ArgList>::execute
-        , policies
+            ::template apply<Holder,ArgList,release_gil_>::execute
+        , policies_t(policies)
         , kw);
 }
 
@@ -5,13 +5,12 @@
 # define UNWRAP_TYPE_ID_DWA2004722_HPP
 
 # include <boost/python/type_id.hpp>
+# include <boost/python/detail/wrapper_base.hpp>
 
 # include <boost/mpl/bool.hpp>
 
 namespace boost { namespace python {
 
-template <class T> class wrapper;
-
 namespace detail { 
 
 template <class T>
@@ -20,8 +19,8 @@ inline type_info unwrap_type_id(T*, ...)
     return type_id<T>();
 }
 
-template <class U, class T>
-inline type_info unwrap_type_id(U*, wrapper<T>*)
+template <class U, class T, gil_mode Mode>
+inline type_info unwrap_type_id(U*, wrapper<T,Mode>*)
 {
     return type_id<T>();
 }
@@ -0,0 +1,54 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef VECTORCALL_HPP
+# define VECTORCALL_HPP
+
+# include <boost/python/detail/prefix.hpp>
+# include <boost/python/attribute_name.hpp>
+
+# include <cstddef>
+
+// Declares c<n>, the Python object converted from argument a<n>. It
+// must outlive the call it's passed to, but not the conversion of
+// the result; see call.hpp.
+# define BOOST_PYTHON_ARG_TO_PYTHON_LOCAL(z, n, _) \
+    converter::arg_to_python<A##n> c##n(a##n);
+
+# define BOOST_PYTHON_ARG_TO_PYTHON_LOCAL_GET(z, n, _) \
+    , c##n.get()
+
+# ifdef BOOST_PYTHON_HAS_VECTORCALL
+
+namespace boost { namespace python { namespace detail {
+
+// Calls callable with the nargs arguments at args[1]...args[nargs].
+// args[0] is scratch space, which lets a bound method prepend its
+// self without copying the arguments.
+inline PyObject* vectorcall(PyObject* callable, PyObject** args, std::size_t nargs)
+{
+    return PyObject_Vectorcall(
+        callable, args + 1, nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, 0);
+}
+
+// Calls the method of args[0] with the given name, passing the nargs
+// arguments at args[1]...args[nargs]. No bound method is created.
+inline PyObject* vectorcall_method(method_name const& name, PyObject** args, std::size_t nargs)
+{
+    if (name.attribute() != 0)
+        return PyObject_VectorcallMethod(name.attribute()->get(), args, nargs + 1, 0);
+
+    PyObject* py_name = PyUnicode_InternFromString(name.c_str());
+    if (py_name == 0)
+        return 0;
+
+    PyObject* result = PyObject_VectorcallMethod(py_name, args, nargs + 1, 0);
+    Py_DECREF(py_name);
+    return result;
+}
+
+}}} // namespace boost::python::detail
+
+# endif // BOOST_PYTHON_HAS_VECTORCALL
+
+#endif // VECTORCALL_HPP
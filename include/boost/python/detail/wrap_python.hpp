@@ -187,6 +187,11 @@ typedef int pid_t;
 
 #endif
 
+// The vectorcall protocol (PEP 590) is public as of Python 3.9
+#if PY_VERSION_HEX >= 0x03090000
+# define BOOST_PYTHON_HAS_VECTORCALL 1
+#endif
+
 
 #ifdef __MWERKS__
 # pragma warn_possunwant off
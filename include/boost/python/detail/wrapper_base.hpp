@@ -5,6 +5,7 @@
 # define WRAPPER_BASE_DWA2004722_HPP
 
 # include <boost/python/detail/prefix.hpp>
+# include <boost/python/handle_fwd.hpp>
 # include <boost/type_traits/is_polymorphic.hpp>
 # include <boost/mpl/bool.hpp>
 
@@ -12,6 +13,15 @@ namespace boost { namespace python {
 
 class override;
 
+// Whether an override assumes that the calling thread holds the GIL,
+// or acquires it when necessary, keeping it for as long as the
+// override lives.
+enum gil_mode { assume_gil, acquire_gil };
+
+template <class T, gil_mode Mode = assume_gil> class wrapper;
+
+namespace converter { struct registration; }
+
 namespace detail
 {
   class BOOST_PYTHON_DECL_FORWARD wrapper_base;
@@ -48,7 +58,13 @@ namespace detail
       override get_override(
           char const* name, PyTypeObject* class_object) const;
 
+      // Looks up the class object in r only once the GIL is held
+      override get_override(
+          char const* name, converter::registration const& r, gil_mode mode) const;
+
    private:
+      handle<> find_override(char const* name, PyTypeObject* class_object) const;
+
       void detach();
       
    private:
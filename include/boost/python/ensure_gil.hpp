@@ -0,0 +1,27 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef ENSURE_GIL_HPP
+# define ENSURE_GIL_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/detail/gil_guard.hpp>
+# include <boost/noncopyable.hpp>
+
+namespace boost { namespace python { 
+
+// Holds the GIL for its lifetime, acquiring it only if the calling
+// thread doesn't already hold it. call<>, call_method<> and overrides
+// obtained with acquire_gil can then be used from any thread. Keeping
+// one alive around a series of such calls acquires the GIL, and sets
+// up the thread's Python state, once for the whole series.
+class ensure_gil : boost::noncopyable
+{
+ private:
+    detail::gil_ensure_guard m_guard;
+};
+
+}} // namespace boost::python
+
+#endif // ENSURE_GIL_HPP
@@ -31,8 +31,13 @@ struct enum_ : public objects::enum_base
     static PyObject* to_python(void const* x);
     static void* convertible_from_python(PyObject* obj);
     static void construct(PyObject* obj, converter::rvalue_from_python_stage1_data* data);
+
+    static objects::enum_value_table values;
 };
 
+template <class T>
+objects::enum_value_table enum_<T>::values;
+
 template <class T>
 inline enum_<T>::enum_(char const* name, char const* doc )
     : base(
@@ -41,6 +46,7 @@ inline enum_<T>::enum_(char const* name, char const* doc )
         , &enum_<T>::convertible_from_python
         , &enum_<T>::construct
         , type_id<T>()
+        , values
         , doc
         )
 {
@@ -51,9 +57,12 @@ inline enum_<T>::enum_(char const* name, char const* doc )
 template <class T>
 PyObject* enum_<T>::to_python(void const* x)
 {
+    long value = static_cast<long>(*(T const*)x);
+    if (PyObject* result = values.find(value))
+        return incref(result);
+
     return base::to_python(
-        converter::registered<T>::converters.m_class_object
-        , static_cast<long>(*(T const*)x));
+        converter::registered<T>::converters.m_class_object, value);
 }
 
 //
@@ -66,10 +75,13 @@ PyObject* enum_<T>::to_python(void const* x)
 template <class T>
 void* enum_<T>::convertible_from_python(PyObject* obj)
 {
+    PyTypeObject* type = converter::registered<T>::converters.m_class_object;
+    if (Py_TYPE(obj) == type)
+        return obj;
+
     return PyObject_IsInstance(
         obj
-        , upcast<PyObject>(
-            converter::registered<T>::converters.m_class_object))
+        , upcast<PyObject>(type))
         
         ? obj : 0;
 }
@@ -24,6 +24,10 @@
 # include <boost/mpl/push_front.hpp>
 # include <boost/mpl/pop_front.hpp>
 # include <boost/mpl/assert.hpp>
+# include <boost/mpl/eval_if.hpp>
+# include <boost/mpl/identity.hpp>
+
+# include <boost/type_traits/is_void.hpp>
 
 namespace boost { namespace python {
 
@@ -35,6 +39,9 @@ namespace detail
       install_holder(PyObject* args_)
         : m_self(PyTuple_GetItem(args_, 0)) {}
 
+      install_holder(vector_args const& args_)
+        : m_self(args_.argv[0]) {}
+
       PyObject* operator()(T x) const
       {
           dispatch(x, is_pointer<T>());
@@ -54,9 +61,8 @@ namespace detail
       {
           typedef typename pointee<Ptr>::type value_type;
           typedef objects::pointer_holder<Ptr,value_type> holder;
-          typedef objects::instance<holder> instance_t;
-
-          void* memory = holder::allocate(this->m_self, offsetof(instance_t, storage), sizeof(holder));
+          void* memory = holder::allocate(
+              this->m_self, objects::holder_offset<holder>(Py_TYPE(this->m_self)), sizeof(holder));
           try {
               (new (memory) holder(x))->install(this->m_self);
           }
@@ -97,6 +103,18 @@ namespace detail
       return arity(args_.base) - Offset::value;
   }
 
+  template <class BaseArgs, class Offset>
+  struct vector_argument_package<offset_args<BaseArgs,Offset> >
+    : mpl::eval_if<
+          is_void<typename vector_argument_package<BaseArgs>::type>
+        , mpl::identity<void>
+        , mpl::identity<
+              offset_args<typename vector_argument_package<BaseArgs>::type,Offset>
+          >
+      >
+  {
+  };
+
   template <class BasePolicy_ = default_call_policies>
   struct constructor_policy : BasePolicy_
   {
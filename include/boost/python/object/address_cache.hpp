@@ -0,0 +1,48 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef ADDRESS_CACHE_HPP
+# define ADDRESS_CACHE_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <map>
+
+namespace boost { namespace python { namespace objects { 
+
+// Maps the addresses of C++ objects to the live Python objects which
+// wrap them, so that returning the same address again yields the same
+// wrapper. The cache holds no references: a wrapper must call erase()
+// for its address while it is being destroyed.
+class BOOST_PYTHON_DECL address_cache
+{
+ public:
+    // Returns a new reference to the wrapper for p, or 0 if there's
+    // none.
+    PyObject* find(void const* p) const;
+
+    void insert(void const* p, PyObject* wrapper);
+
+    // Removes the entry for p if its wrapper is being destroyed. A
+    // live wrapper which has replaced it is kept.
+    void erase(void const* p);
+
+ private:
+    typedef std::map<void const*, PyObject*> map_type;
+    map_type m_wrappers;
+};
+
+// The cache for wrappers of a given kind, such as the pointer holders
+// of one class or the opaque wrappers of one pointee type.
+template <class T>
+struct registered_address_cache
+{
+    static address_cache cache;
+};
+
+template <class T>
+address_cache registered_address_cache<T>::cache;
+
+}}} // namespace boost::python::objects
+
+#endif // ADDRESS_CACHE_HPP
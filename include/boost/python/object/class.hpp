@@ -32,6 +32,15 @@ struct BOOST_PYTHON_DECL class_base : python::api::object
     // require use of template friend declarations.
     void enable_pickling_(bool getstate_manages_dict);
 
+    // Implementation detail of pooled_instances: allocate instances
+    // from a free list of up to capacity blocks, each large enough
+    // for a holder of holder_size bytes.
+    void enable_instance_pool_(std::size_t capacity, std::size_t holder_size);
+
+    // Implementation detail of compact_instance: drop the __dict__
+    // and __weakref__ slots from instances of the class.
+    void make_instances_compact_();
+
  protected:
     void add_property(
         char const* name, object const& fget, char const* docstr);
@@ -88,7 +88,10 @@ template <class T, class Bases>
 inline void register_shared_ptr_from_python_and_casts(T*, Bases)
 {
     // Constructor performs registration
-    python::detail::force_instantiate(converter::shared_ptr_from_python<T>());
+    python::detail::force_instantiate(converter::shared_ptr_from_python<T, boost::shared_ptr>());
+#ifndef BOOST_NO_CXX11_SMART_PTR
+    python::detail::force_instantiate(converter::shared_ptr_from_python<T, std::shared_ptr>());
+#endif
 
     //
     // register all up/downcasts here.  We're using the alternate
@@ -206,8 +209,8 @@ struct class_metadata
     }
 
  private:
-    template <class T2>
-    inline static void register_aux(python::wrapper<T2>*) 
+    template <class T2, gil_mode Mode>
+    inline static void register_aux(python::wrapper<T2,Mode>*) 
     {
         typedef typename mpl::not_<is_same<T2,wrapped> >::type use_callback;
         class_metadata::register_aux2((T2*)0, use_callback());
@@ -9,6 +9,7 @@
 #ifndef BOOST_PYTHON_NO_PY_SIGNATURES
 # include <boost/python/converter/pytype_function.hpp>
 #endif
+# include <boost/python/object/forward.hpp>
 # include <boost/ref.hpp>
 
 namespace boost { namespace python { namespace objects { 
@@ -24,10 +25,28 @@ template <class Src, class MakeInstance>
 struct class_cref_wrapper
     : to_python_converter<Src,class_cref_wrapper<Src,MakeInstance> ,true>
 {
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    // Also register a converter for temporaries, which moves them
+    // into the new instance rather than copying them.
+    class_cref_wrapper()
+    {
+        converter::registry::insert_move(&convert_rvalue, type_id<Src>());
+    }
+# endif
+
     static PyObject* convert(Src const& x)
     {
         return MakeInstance::execute(boost::ref(x));
     }
+
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    static PyObject* convert_rvalue(void const* x)
+    {
+        rvalue_reference_to_value<Src> const source(
+            *const_cast<Src*>(static_cast<Src const*>(x)));
+        return MakeInstance::execute(source);
+    }
+# endif
 #ifndef BOOST_PYTHON_NO_PY_SIGNATURES
     static PyTypeObject const *get_pytype() { return converter::registered_pytype_direct<Src>::get_pytype(); }
 #endif
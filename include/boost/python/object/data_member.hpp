@@ -0,0 +1,66 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef DATA_MEMBER_HPP
+# define DATA_MEMBER_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/object_core.hpp>
+# include <boost/python/type_id.hpp>
+# include <boost/python/to_python_value.hpp>
+# include <boost/python/extract.hpp>
+
+# include <boost/type_traits/alignment_of.hpp>
+# include <boost/type_traits/type_with_alignment.hpp>
+
+# include <cstddef>
+
+namespace boost { namespace python { namespace objects { 
+
+// Converts the Data at field to a new Python object
+typedef PyObject* (*data_member_getter)(void const* field);
+
+// Assigns the Data at field from value, throwing if value doesn't
+// convert.
+typedef void (*data_member_setter)(void* field, PyObject* value);
+
+template <class Data>
+PyObject* get_data_member(void const* field)
+{
+    return to_python_value<Data const&>()(*static_cast<Data const*>(field));
+}
+
+template <class Data>
+void set_data_member(void* field, PyObject* value)
+{
+    *static_cast<Data*>(field) = extract<Data>(value)();
+}
+
+// Returns the offset of the data member pm within a Class object.
+template <class Data, class Class>
+std::ptrdiff_t data_member_offset(Data Class::*pm)
+{
+    // Applying pm to a pointer doesn't touch the object, so no Class
+    // needs to be constructed in the storage.
+    union
+    {
+        typename type_with_alignment<alignment_of<Class>::value>::type align;
+        char bytes[sizeof(Class)];
+    } storage;
+
+    Class const* p = reinterpret_cast<Class const*>(storage.bytes);
+    return reinterpret_cast<char const*>(&(p->*pm)) - storage.bytes;
+}
+
+// Returns a descriptor which gets and, given a setter, sets the data
+// member at offset in the class_id object held by an instance. Unlike
+// a property built from make_getter and make_setter, it doesn't go
+// through a wrapped function call on each access.
+BOOST_PYTHON_DECL object make_data_member(
+    type_info class_id, std::ptrdiff_t offset
+  , data_member_getter get, data_member_setter set, char const* doc);
+
+}}} // namespace boost::python::objects
+
+#endif // DATA_MEMBER_HPP
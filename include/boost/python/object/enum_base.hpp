@@ -11,8 +11,44 @@
 # include <boost/python/converter/convertible_function.hpp>
 # include <boost/python/converter/constructor_function.hpp>
 
+# include <cstddef>
+# include <utility>
+# include <vector>
+
 namespace boost { namespace python { namespace objects { 
 
+// The Python objects for the named values of an enum, which spares
+// converting a value to Python a lookup in the type's "values"
+// dict. Values are found by indexing when they fall in a small range,
+// and by binary search otherwise.
+class BOOST_PYTHON_DECL enum_value_table
+{
+ public:
+    enum_value_table();
+
+    // Returns a borrowed reference to the object for value, or 0 if
+    // there is none.
+    PyObject* find(long value) const
+    {
+        if (m_dense.empty())
+            return this->find_sparse(value);
+
+        std::size_t i = static_cast<unsigned long>(value) - static_cast<unsigned long>(m_first);
+        return i < m_dense.size() ? m_dense[i] : 0;
+    }
+
+    // Maps value to x, replacing any previous mapping.
+    void insert(long value, PyObject* x);
+
+ private:
+    PyObject* find_sparse(long value) const;
+
+    typedef std::pair<long, PyObject*> entry;
+    std::vector<entry> m_entries; // sorted by value
+    std::vector<PyObject*> m_dense;
+    long m_first;
+};
+
 struct BOOST_PYTHON_DECL enum_base : python::api::object
 {
  protected:
@@ -22,6 +58,7 @@ struct BOOST_PYTHON_DECL enum_base : python::api::object
         , converter::convertible_function
         , converter::constructor_function
         , type_info
+        , enum_value_table&
         , const char *doc = 0
         );
 
@@ -29,6 +66,9 @@ struct BOOST_PYTHON_DECL enum_base : python::api::object
     void export_values();
     
     static PyObject* to_python(PyTypeObject* type, long x);
+
+ private:
+    enum_value_table* m_values;
 };
 
 }}} // namespace boost::python::object
@@ -36,6 +36,19 @@ struct reference_to_value
     reference m_value;
 };
 
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+// Like reference_to_value<T>, except that the object referred to is
+// unforwarded as an rvalue, so that the destination may move from it.
+template <class T>
+struct rvalue_reference_to_value
+{
+    explicit rvalue_reference_to_value(T& x) : m_value(x) {}
+    T&& get() const { return static_cast<T&&>(m_value); }
+ private:
+    T& m_value;
+};
+# endif
+
 // A little metaprogram which selects the type to pass through an
 // intermediate forwarding function when the destination argument type
 // is T.
@@ -183,6 +196,14 @@ do_unforward(reference_wrapper<T> const& x, int)
     return x.get();
 }
 
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+template <class T>
+T&& do_unforward(rvalue_reference_to_value<T> const& x, int)
+{
+    return x.get();
+}
+# endif
+
 template <class T>
 T const& do_unforward(T const& x, ...)
 {
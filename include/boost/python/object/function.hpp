@@ -11,6 +11,8 @@
 # include <boost/function/function2.hpp>
 # include <boost/python/object_core.hpp>
 # include <boost/python/object/py_function.hpp>
+# include <cstddef>
+# include <vector>
 
 namespace boost { namespace python { namespace objects { 
 
@@ -25,6 +27,11 @@ struct BOOST_PYTHON_DECL function : PyObject
     ~function();
     
     PyObject* call(PyObject*, PyObject*) const;
+    
+    // Calls with positional arguments in argv[0..nargs) and, if
+    // kwnames is non-null, keyword arguments named by kwnames in
+    // argv[nargs..nargs+len(kwnames)), as in Python's vectorcall.
+    PyObject* call(PyObject* const* argv, std::size_t nargs, PyObject* kwnames) const;
 
     // Add an attribute to the name_space with the given name. If it is
     // a function object (this class), and an existing function is
@@ -46,6 +53,17 @@ struct BOOST_PYTHON_DECL function : PyObject
     object signature(bool show_return_type=false) const;
     object signatures(bool show_return_type=false) const;
     void argument_error(PyObject* args, PyObject* keywords) const;
+    PyObject* call_with_keywords(
+        PyObject* const* argv, std::size_t nargs, PyObject* kwnames) const;
+    bool bind_arguments(
+        PyObject* const* argv, std::size_t nargs
+      , PyObject* kwnames, PyObject* kwdict
+      , PyObject** inner_args) const;
+    bool bind_keyword(
+        PyObject* name, PyObject* value, std::size_t nargs, PyObject** inner_args) const;
+    function const* find_cached_overload(PyObject* const* argv, std::size_t nargs) const;
+    void cache_overload(PyObject* const* argv, std::size_t nargs, function const* f) const;
+    void clear_overload_cache();
     void add_overload(handle<function> const&);
     
  private: // data members
@@ -56,6 +74,39 @@ struct BOOST_PYTHON_DECL function : PyObject
     object m_doc;
     object m_arg_names;
     unsigned m_nkeyword_values;
+    
+    // The keyword names and default values from m_arg_names, by
+    // argument position. Either may be null.
+    struct keyword_entry
+    {
+        keyword_entry() : name(0), default_value(0) {}
+        
+        PyObject* name;
+        PyObject* default_value;
+    };
+    std::vector<keyword_entry> m_keywords;
+#ifdef BOOST_PYTHON_HAS_VECTORCALL
+    vectorcallfunc m_vectorcall;
+#endif
+
+    // A small cache mapping the Python types of the positional
+    // arguments to the overload which last accepted them, so that
+    // calls with the same argument types skip the overloads which
+    // were already found not to match. Holding references to the
+    // types keeps their addresses from being reused.
+    enum { overload_cache_size = 4, overload_cache_max_arity = 5 };
+    
+    struct overload_cache_entry
+    {
+        overload_cache_entry() : overload(0), nargs(0) {}
+        
+        function const* overload;
+        std::size_t nargs;
+        handle<PyTypeObject> types[overload_cache_max_arity];
+    };
+    
+    mutable overload_cache_entry m_overload_cache[overload_cache_size];
+    mutable unsigned m_overload_cache_next;
     friend class function_doc_signature_generator;
 };
 
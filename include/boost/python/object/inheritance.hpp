@@ -8,9 +8,13 @@
 # include <boost/python/type_id.hpp>
 # include <boost/shared_ptr.hpp>
 # include <boost/mpl/if.hpp>
+# include <boost/mpl/and.hpp>
+# include <boost/mpl/not.hpp>
 # include <boost/type_traits/is_polymorphic.hpp>
 # include <boost/type_traits/is_base_and_derived.hpp>
+# include <boost/type_traits/is_virtual_base_of.hpp>
 # include <boost/detail/workaround.hpp>
+# include <cstddef>
 
 namespace boost { namespace python { namespace objects {
 
@@ -27,6 +31,13 @@ BOOST_PYTHON_DECL void register_dynamic_id_aux(
 BOOST_PYTHON_DECL void add_cast(
     class_id src_t, class_id dst_t, void* (*cast)(void*), bool is_downcast);
 
+// Records that the dst_t subobject of any src_t object is found at
+// the given offset from its start, so that upcasts from src_t to
+// dst_t, or to any base already recorded for dst_t, need no search
+// of the cast graph.
+BOOST_PYTHON_DECL void add_upcast_offset(
+    class_id src_t, class_id dst_t, std::ptrdiff_t offset);
+
 //
 // a generator with an execute() function which, given a source type
 // and a pointer to an object of that type, returns its most-derived
@@ -111,6 +122,48 @@ struct cast_generator
 {
 };
 
+//
+// a generator with an execute() function which records the offset of
+// the Target subobject of a Source object, when Target is a
+// non-virtual base of Source and the offset is therefore constant.
+//
+
+template <class Source, class Target>
+struct upcast_offset_generator
+{
+    static void execute()
+    {
+        // No object is accessed, so any suitably aligned address will
+        // do: converting to a non-virtual base only adjusts the pointer.
+        Source* const source = reinterpret_cast<Source*>(static_cast<std::size_t>(0x1000));
+        Target* const target = source;
+        
+        add_upcast_offset(
+            python::type_id<Source>()
+          , python::type_id<Target>()
+          , reinterpret_cast<char const volatile*>(target)
+            - reinterpret_cast<char const volatile*>(source));
+    }
+};
+
+struct no_upcast_offset
+{
+    static void execute() {}
+};
+
+template <class Source, class Target>
+struct upcast_offset_registrar
+  : mpl::if_<
+        mpl::and_<
+            is_base_and_derived<Target,Source>
+          , mpl::not_<is_virtual_base_of<Target,Source> >
+        >
+      , upcast_offset_generator<Source,Target>
+      , no_upcast_offset
+    >
+{
+};
+
 template <class Source, class Target>
 inline void register_conversion(
     bool is_downcast = ::boost::is_base_and_derived<Source,Target>::value
@@ -125,6 +178,8 @@ inline void register_conversion(
       , &generator::execute
       , is_downcast
     );
+
+    upcast_offset_registrar<Source,Target>::type::execute();
 }
 
 }}} // namespace boost::python::object
@@ -16,14 +16,15 @@ namespace boost { namespace python
 
 namespace boost { namespace python { namespace objects { 
 
-// Each extension instance will be one of these
+// Each extension instance will be one of these. Instances of compact
+// classes end before dict, and their holders start right there.
 template <class Data = char>
 struct instance
 {
     PyObject_VAR_HEAD
+    instance_holder* objects;
     PyObject* dict;
     PyObject* weakrefs; 
-    instance_holder* objects;
 
     typedef typename type_with_alignment<
         ::boost::alignment_of<Data>::value
@@ -46,6 +47,16 @@ struct additional_instance_size
                            - BOOST_PYTHON_OFFSETOF(instance_char,storage));
 };
 
+// The offset at which a Data object is stored in instances of type:
+// the end of the type's fixed-size part, suitably aligned. Except for
+// compact classes, that is offsetof(instance<Data>, storage).
+template <class Data>
+inline std::size_t holder_offset(PyTypeObject* type)
+{
+    std::size_t const align = ::boost::alignment_of<Data>::value;
+    return (static_cast<std::size_t>(type->tp_basicsize) + align - 1) / align * align;
+}
+
 }}} // namespace boost::python::object
 
 #endif // INSTANCE_DWA200295_HPP
@@ -16,6 +16,10 @@
 # include <boost/python/object/iterator_core.hpp>
 # include <boost/python/object/class_detail.hpp>
 # include <boost/python/object/function_object.hpp>
+# include <boost/python/object/find_instance.hpp>
+
+# include <boost/python/detail/caller.hpp>
+# include <boost/python/errors.hpp>
 
 # include <boost/mpl/vector/vector10.hpp>
 # include <boost/mpl/if.hpp>
@@ -108,6 +112,66 @@ struct iterator_range
 
 namespace detail
 {
+  // Advances the iterator_range held by a Python iterator and
+  // converts the element it was at, applying NextPolicies as a
+  // wrapped next() function would.
+  template <class NextPolicies, class Iterator>
+  struct iterator_range_step
+  {
+      typedef iterator_range<NextPolicies,Iterator> range_;
+      typedef typename range_::next_fn next_fn;
+      typedef typename next_fn::result_type result_type;
+      typedef typename python::detail::select_result_converter<
+          NextPolicies, result_type
+      >::type result_converter;
+
+      iterator_range_step(PyObject* self_, range_& range__, PyObject*& result_)
+        : self(self_), range(range__), result(result_) {}
+
+      void operator()() const
+      {
+          handle<> args(PyTuple_Pack(1, self));
+          NextPolicies policies;
+          if (!policies.precall(args.get()))
+              throw_error_already_set();
+
+          PyObject* x = python::detail::create_result_converter(
+              args.get(), (result_converter*)0, (result_converter*)0
+          )(next_fn()(range));
+
+          result = policies.postcall(args.get(), x);
+          if (result == 0)
+              throw_error_already_set();
+      }
+
+      PyObject* self;
+      range_& range;
+      PyObject*& result;
+  };
+
+  // The tp_iternext slot of the Python class wrapping an
+  // iterator_range. Unlike its __next__ method, it isn't dispatched
+  // through a wrapped function, and it reports the end of the range
+  // by returning null instead of throwing to raise StopIteration.
+  template <class NextPolicies, class Iterator>
+  PyObject* iterator_range_next(PyObject* self)
+  {
+      typedef iterator_range<NextPolicies,Iterator> range_;
+
+      range_* range = static_cast<range_*>(
+          find_instance_impl(self, python::type_id<range_>()));
+      if (range == 0)
+          return iterator_range_unbound(self);
+
+      if (range->m_start == range->m_finish)
+          return 0;
+
+      PyObject* result = 0;
+      return handle_exception(
+          iterator_range_step<NextPolicies,Iterator>(self, *range, result)
+      ) ? 0 : result;
+  }
+
   // Get a Python class which contains the given iterator and
   // policies, creating it if necessary. Requires: NextPolicies is
   // default-constructible.
@@ -126,7 +190,7 @@ namespace detail
       typedef typename range_::next_fn next_fn;
       typedef typename next_fn::result_type result_type;
       
-      return class_<range_>(name, no_init)
+      object result = class_<range_>(name, no_init)
           .def("__iter__", identity_function())
           .def(
 #if PY_VERSION_HEX >= 0x03000000
@@ -139,6 +203,9 @@ namespace detail
               , policies
               , mpl::vector2<result_type,range_&>()
             ));
+
+      set_iterator_slots(result, &iterator_range_next<NextPolicies,Iterator>);
+      return result;
   }
 
   // A function object which builds an iterator_range.
@@ -12,6 +12,16 @@ namespace boost { namespace python { namespace objects {
 BOOST_PYTHON_DECL object const& identity_function();
 BOOST_PYTHON_DECL void stop_iteration_error();
 
+// Makes instances of the given iterator class return themselves from
+// tp_iter and step with next in tp_iternext, bypassing the wrapped
+// __iter__ and __next__ methods.
+BOOST_PYTHON_DECL void set_iterator_slots(
+    object const& iterator_class, PyObject* (*next)(PyObject*));
+
+// Raises TypeError for an iterator whose C++ range was never
+// constructed, and returns null.
+BOOST_PYTHON_DECL PyObject* iterator_range_unbound(PyObject* self);
+
 }}} // namespace boost::python::object
 
 #endif // ITERATOR_CORE_DWA2002512_HPP
@@ -18,7 +18,10 @@
 
 #  include <boost/python/object/forward.hpp>
 #  include <boost/python/detail/preprocessor.hpp>
+#  include <boost/python/detail/gil_guard.hpp>
 
+#  include <boost/mpl/bool.hpp>
+#  include <boost/mpl/if.hpp>
 #  include <boost/mpl/next.hpp>
 #  include <boost/mpl/begin_end.hpp>
 #  include <boost/mpl/deref.hpp>
@@ -61,7 +64,9 @@ template <int nargs> struct make_holder;
 template <>
 struct make_holder<N>
 {
-    template <class Holder, class ArgList>
+    // If ReleaseGil is true, the GIL is released while the Holder is
+    // being constructed
+    template <class Holder, class ArgList, class ReleaseGil = mpl::false_>
     struct apply
     {
 # if N
@@ -88,12 +93,21 @@ struct make_holder<N>
 #endif
             BOOST_PP_ENUM_TRAILING_BINARY_PARAMS_Z(1, N, t, a))
         {
-            typedef instance<Holder> instance_t;
+            typedef typename mpl::if_<
+                ReleaseGil
+              , python::detail::gil_release_guard
+              , python::detail::no_gil_release_guard
+            >::type gil_guard;
             
-            void* memory = Holder::allocate(p, offsetof(instance_t, storage), sizeof(Holder));
+            void* memory = Holder::allocate(p, holder_offset<Holder>(Py_TYPE(p)), sizeof(Holder));
             try {
-                (new (memory) Holder(
-                    p BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_DO_FORWARD_ARG, nil)))->install(p);
+                Holder* holder;
+                {
+                    gil_guard guard;
+                    holder = new (memory) Holder(
+                        p BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_DO_FORWARD_ARG, nil));
+                }
+                holder->install(p);
             }
             catch(...) {
                 Holder::deallocate(p, memory);
@@ -7,6 +7,7 @@
 
 # include <boost/python/detail/prefix.hpp>
 # include <boost/python/object/instance.hpp>
+# include <boost/python/object/forward.hpp>
 # include <boost/python/converter/registered.hpp>
 # include <boost/python/detail/decref_guard.hpp>
 # include <boost/python/detail/none.hpp>
@@ -31,8 +32,9 @@ struct make_instance_impl
         if (type == 0)
             return python::detail::none();
 
+        std::size_t const offset = objects::holder_offset<Holder>(type);
         PyObject* raw_result = type->tp_alloc(
-            type, objects::additional_instance_size<Holder>::value);
+            type, offset + sizeof(Holder) - type->tp_basicsize);
           
         if (raw_result != 0)
         {
@@ -42,11 +44,11 @@ struct make_instance_impl
             
             // construct the new C++ object and install the pointer
             // in the Python object.
-            Derived::construct(&instance->storage, (PyObject*)instance, x)->install(raw_result);
+            Derived::construct((char*)instance + offset, (PyObject*)instance, x)->install(raw_result);
               
             // Note the position of the internally-stored Holder,
             // for the sake of destruction
-            Py_SIZE(instance) = offsetof(instance_t, storage);
+            Py_SIZE(instance) = offset;
 
             // Release ownership of the python object
             protect.cancel();
@@ -70,6 +72,14 @@ struct make_instance
     {
         return new (storage) Holder(instance, x);
     }
+
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    // Moves x into the new holder
+    static inline Holder* construct(void* storage, PyObject* instance, rvalue_reference_to_value<T> x)
+    {
+        return new (storage) Holder(instance, x);
+    }
+# endif
 };
   
 
@@ -37,13 +37,6 @@
 
 #  include <boost/type_traits/remove_const.hpp>
 
-namespace boost { namespace python {
-
-template <class T> class wrapper;
-
-}}
-
-
 namespace boost { namespace python { namespace objects {
 
 #  if BOOST_WORKAROUND(__GNUC__, == 2)
@@ -69,8 +62,8 @@ struct pointer_holder : instance_holder
  private: // required holder implementation
     void* holds(type_info, bool null_ptr_only);
     
-    template <class T>
-    inline void* holds_wrapped(type_info dst_t, wrapper<T>*,T* p)
+    template <class T, gil_mode Mode>
+    inline void* holds_wrapped(type_info dst_t, wrapper<T,Mode>*,T* p)
     {
         return python::type_id<T>() == dst_t ? p : 0;
     }
@@ -10,22 +10,54 @@
 # include <boost/mpl/size.hpp>
 # include <memory>
 
-namespace boost { namespace python { namespace objects {
+namespace boost { namespace python {
+
+namespace detail
+{
+  template <class F, class CallPolicies, class Sig> struct caller;
+}
+
+namespace objects {
 
 // This type is used as a "generalized Python callback", wrapping the
 // function signature:
 //
 //      PyObject* (PyObject* args, PyObject* keywords)
+//
+// and, for vectorcalls without keywords, the signature:
+//
+//      PyObject* (PyObject* const* argv, unsigned nargs)
 
 struct BOOST_PYTHON_DECL py_function_impl_base
 {
     virtual ~py_function_impl_base();
     virtual PyObject* operator()(PyObject*, PyObject*) = 0;
+    
+    // The default implementation packs argv into a tuple.
+    virtual PyObject* operator()(PyObject* const* argv, unsigned nargs);
+    
     virtual unsigned min_arity() const = 0;
     virtual unsigned max_arity() const;
     virtual python::detail::py_func_sig_info signature() const = 0;
 };
 
+// Dispatches a vectorcall to Caller, which only understands argument
+// tuples unless it is a detail::caller<>.
+template <class Caller>
+inline PyObject* vector_call(
+    Caller&, PyObject* const* argv, unsigned nargs, py_function_impl_base& impl)
+{
+    return impl.py_function_impl_base::operator()(argv, nargs);
+}
+
+template <class F, class CallPolicies, class Sig>
+inline PyObject* vector_call(
+    python::detail::caller<F,CallPolicies,Sig>& caller
+  , PyObject* const* argv, unsigned nargs, py_function_impl_base&)
+{
+    return caller(argv, nargs);
+}
+
 template <class Caller>
 struct caller_py_function_impl : py_function_impl_base
 {
@@ -37,6 +69,11 @@ struct caller_py_function_impl : py_function_impl_base
     {
         return m_caller(args, kw);
     }
+
+    PyObject* operator()(PyObject* const* argv, unsigned nargs)
+    {
+        return objects::vector_call(m_caller, argv, nargs, *this);
+    }
     
     virtual unsigned min_arity() const
     {
@@ -63,6 +100,11 @@ struct signature_py_function_impl : py_function_impl_base
     {
         return m_caller(args, kw);
     }
+
+    PyObject* operator()(PyObject* const* argv, unsigned nargs)
+    {
+        return objects::vector_call(m_caller, argv, nargs, *this);
+    }
     
     virtual unsigned min_arity() const
     {
@@ -93,6 +135,11 @@ struct full_py_function_impl : py_function_impl_base
     {
         return m_caller(args, kw);
     }
+
+    PyObject* operator()(PyObject* const* argv, unsigned nargs)
+    {
+        return objects::vector_call(m_caller, argv, nargs, *this);
+    }
     
     virtual unsigned min_arity() const
     {
@@ -143,6 +190,11 @@ struct py_function
         return (*m_impl)(args, kw);
     }
 
+    PyObject* operator()(PyObject* const* argv, unsigned nargs) const
+    {
+        return (*m_impl)(argv, nargs);
+    }
+
     unsigned min_arity() const
     {
         return m_impl->min_arity();
@@ -52,8 +52,8 @@ struct value_holder : instance_holder
  private: // required holder implementation
     void* holds(type_info, bool null_ptr_only);
     
-    template <class T>
-    inline void* holds_wrapped(type_info dst_t, wrapper<T>*,T* p)
+    template <class T, gil_mode Mode>
+    inline void* holds_wrapped(type_info dst_t, wrapper<T,Mode>*,T* p)
     {
         return python::type_id<T>() == dst_t ? p : 0;
     }
@@ -38,6 +38,19 @@ struct objattribute_policies : const_objattribute_policies
     static void del(object const&target, object const& key);
 };
 
+// The name is held by address, since it caches the interned string
+struct const_nameattribute_policies
+{
+    typedef attribute_name const* key_type;
+    static object get(object const& target, attribute_name const* key);
+};
+
+struct nameattribute_policies : const_nameattribute_policies
+{
+    static object const& set(object const& target, attribute_name const* key, object const& value);
+    static void del(object const&target, attribute_name const* key);
+};
+
 //
 // implementation
 //
@@ -69,6 +82,20 @@ inline const_object_objattribute object_operators<U>::attr(object const& name) c
     return const_object_objattribute(x, name);
 }
 
+template <class U>
+inline object_nameattribute object_operators<U>::attr(attribute_name const& name)
+{
+    object_cref2 x = *static_cast<U*>(this);
+    return object_nameattribute(x, &name);
+}
+
+template <class U>
+inline const_object_nameattribute object_operators<U>::attr(attribute_name const& name) const
+{
+    object_cref2 x = *static_cast<U const*>(this);
+    return const_object_nameattribute(x, &name);
+}
+
 inline object const_attribute_policies::get(object const& target, char const* key)
 {
     return python::getattr(target, key);
@@ -79,6 +106,11 @@ inline object const_objattribute_policies::get(object const& target, object cons
     return python::getattr(target, key);
 }
 
+inline object const_nameattribute_policies::get(object const& target, attribute_name const* key)
+{
+    return python::getattr(target, *key);
+}
+
 inline object const& attribute_policies::set(
     object const& target
     , char const* key
@@ -97,6 +129,15 @@ inline object const& objattribute_policies::set(
     return value;
 }
 
+inline object const& nameattribute_policies::set(
+    object const& target
+    , attribute_name const* key
+    , object const& value)
+{
+    python::setattr(target, *key, value);
+    return value;
+}
+
 inline void attribute_policies::del(
     object const& target
     , char const* key)
@@ -111,6 +152,13 @@ inline void objattribute_policies::del(
     python::delattr(target, key);
 }
 
+inline void nameattribute_policies::del(
+    object const& target
+    , attribute_name const* key)
+{
+    python::delattr(target, *key);
+}
+
 }}} // namespace boost::python::api
 
 #endif // OBJECT_ATTRIBUTES_DWA2002615_HPP
@@ -13,6 +13,7 @@
 
 # include <boost/python/call.hpp>
 # include <boost/python/handle_fwd.hpp>
+# include <boost/python/attribute_name.hpp>
 # include <boost/python/errors.hpp>
 # include <boost/python/refcount.hpp>
 # include <boost/python/detail/preprocessor.hpp>
@@ -69,6 +70,8 @@ namespace api
   struct attribute_policies;
   struct const_objattribute_policies;
   struct objattribute_policies;
+  struct const_nameattribute_policies;
+  struct nameattribute_policies;
   struct const_item_policies;
   struct item_policies;
   struct const_slice_policies;
@@ -79,6 +82,8 @@ namespace api
   typedef proxy<attribute_policies> object_attribute;
   typedef proxy<const_objattribute_policies> const_object_objattribute;
   typedef proxy<objattribute_policies> object_objattribute;
+  typedef proxy<const_nameattribute_policies> const_object_nameattribute;
+  typedef proxy<nameattribute_policies> object_nameattribute;
   typedef proxy<const_item_policies> const_object_item;
   typedef proxy<item_policies> object_item;
   typedef proxy<const_slice_policies> const_object_slice;
@@ -127,6 +132,8 @@ namespace api
       object_attribute attr(char const*);
       const_object_objattribute attr(object const&) const;
       object_objattribute attr(object const&);
+      const_object_nameattribute attr(attribute_name const&) const;
+      object_nameattribute attr(attribute_name const&);
 
       // Wrap 'in' operator (aka. __contains__)
       template <class T>
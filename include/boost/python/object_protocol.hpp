@@ -35,6 +35,17 @@ object getattr(Target const& target, Key const& key, Default const& default_ BOO
     return getattr(object(target), object(key), object(default_));
 }
 
+template <class Target>
+object getattr(Target const& target, attribute_name const& key)
+{
+    return getattr(object(target), key);
+}
+
+template <class Target, class Default>
+object getattr(Target const& target, attribute_name const& key, Default const& default_)
+{
+    return getattr(object(target), key, object(default_));
+}
 
 template <class Key, class Value>
 void setattr(object const& target, Key const& key, Value const& value BOOST_PYTHON_NO_ARRAY_ARG(Key))
@@ -42,6 +53,12 @@ void setattr(object const& target, Key const& key, Value const& value BOOST_PYTH
     setattr(target, object(key), object(value));
 }
 
+template <class Value>
+void setattr(object const& target, attribute_name const& key, Value const& value)
+{
+    setattr(target, key, object(value));
+}
+
 template <class Key>
 void delattr(object const& target, Key const& key BOOST_PYTHON_NO_ARRAY_ARG(Key))
 {
@@ -8,6 +8,7 @@
 # include <boost/python/detail/prefix.hpp>
 
 # include <boost/python/handle_fwd.hpp>
+# include <boost/python/attribute_name.hpp>
 
 namespace boost { namespace python { 
 
@@ -26,6 +27,11 @@ namespace api
   BOOST_PYTHON_DECL object getattr(object const& target, char const* key, object const& default_);
   BOOST_PYTHON_DECL void setattr(object const& target, char const* key, object const& value);
   BOOST_PYTHON_DECL void delattr(object const& target, char const* key);
+
+  BOOST_PYTHON_DECL object getattr(object const& target, attribute_name const& key);
+  BOOST_PYTHON_DECL object getattr(object const& target, attribute_name const& key, object const& default_);
+  BOOST_PYTHON_DECL void setattr(object const& target, attribute_name const& key, object const& value);
+  BOOST_PYTHON_DECL void delattr(object const& target, attribute_name const& key);
   
   BOOST_PYTHON_DECL object getitem(object const& target, object const& key);
   BOOST_PYTHON_DECL void setitem(object const& target, object const& key, object const& value);
@@ -14,6 +14,7 @@
 # include <boost/python/converter/registrations.hpp>
 # include <boost/python/detail/dealloc.hpp>
 # include <boost/python/detail/none.hpp>
+# include <boost/python/object/address_cache.hpp>
 # include <boost/python/type_id.hpp>
 # include <boost/python/errors.hpp>
 
@@ -86,6 +87,15 @@ private:
         }
     }
 
+    // Removes the wrapper from the cache used by
+    // cache_by_address<return_opaque_pointer>, if it is there.
+    static void dealloc(PyObject* op)
+    {
+        objects::registered_address_cache<opaque>::cache.erase(
+            static_cast<python_instance*>(implicit_cast<void*>(op))->x);
+        ::boost::python::detail::dealloc(op);
+    }
+
     void register_self()
     {
         converter::registration const *existing =
@@ -125,7 +135,7 @@ PyTypeObject opaque<Pointee>::type_object =
     0,
     sizeof( BOOST_DEDUCED_TYPENAME opaque<Pointee>::python_instance ),
     0,
-    ::boost::python::detail::dealloc,
+    &opaque<Pointee>::dealloc,
     0,          /* tp_print */
     0,          /* tp_getattr */
     0,          /* tp_setattr */
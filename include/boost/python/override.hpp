@@ -9,6 +9,10 @@
 # include <boost/python/detail/prefix.hpp>
 
 # include <boost/python/converter/return_from_python.hpp>
+# include <boost/python/converter/arg_to_python.hpp>
+# include <boost/python/detail/vectorcall.hpp>
+# include <boost/python/detail/gil_guard.hpp>
+# include <boost/python/detail/wrapper_base.hpp>
 
 # include <boost/python/extract.hpp>
 # include <boost/python/handle.hpp>
@@ -84,23 +88,36 @@ namespace detail
   };
 }
 
-class override : public object
+// The GIL guard comes first, so that with acquire_gil the GIL is
+// held until the object has let go of the Python callable.
+class override : private detail::shared_gil_guard, public object
 {
  private:
     friend class detail::wrapper_base;
     override(handle<> x)
-      : object(x)
+      : detail::shared_gil_guard(false)
+      , object(x)
+    {}
+
+    // Acquires the GIL as requested, then refers to None.
+    explicit override(gil_mode mode)
+      : detail::shared_gil_guard(mode == acquire_gil)
     {}
     
  public:
     detail::method_result
     operator()() const
     {
+# ifdef BOOST_PYTHON_HAS_VECTORCALL
+        PyObject* args[1] = { 0 };
+        detail::method_result x(detail::vectorcall(this->ptr(), args, 0));
+# else
         detail::method_result x(
             PyEval_CallFunction(
                 this->ptr()
               , const_cast<char*>("()")
             ));
+# endif
         return x;
     }
 
@@ -131,12 +148,24 @@ template <
 detail::method_result
 operator()( BOOST_PP_ENUM_BINARY_PARAMS_Z(1, N, A, const& a) ) const
 {
+# ifdef BOOST_PYTHON_HAS_VECTORCALL
+    PyObject* result;
+    {
+        BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_ARG_TO_PYTHON_LOCAL, nil)
+        PyObject* args[N + 1] = {
+            0 BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_ARG_TO_PYTHON_LOCAL_GET, nil)
+        };
+        result = detail::vectorcall(this->ptr(), args, N);
+    }
+    detail::method_result x(result);
+# else
     detail::method_result x(
         PyEval_CallFunction(
             this->ptr()
           , const_cast<char*>("(" BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_FIXED, "O") ")")
             BOOST_PP_REPEAT_1ST(N, BOOST_PYTHON_fast_arg_to_python_get, nil)
         ));
+# endif
     return x;
 }
 
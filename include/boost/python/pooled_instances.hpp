@@ -0,0 +1,49 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef POOLED_INSTANCES_HPP
+# define POOLED_INSTANCES_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/def_visitor.hpp>
+# include <boost/python/object/instance.hpp>
+# include <cstddef>
+
+namespace boost { namespace python {
+
+// Passed to class_<>::def(), keeps the memory of up to capacity
+// freed instances of the class for reuse by the next ones, which
+// saves allocator traffic for small types returned by value in tight
+// loops. The class' __instance_pool__ attribute reports the pool's
+// capacity, current size, and the allocations it served (hits) or
+// had to pass on to the allocator (misses). Instances of classes
+// derived in Python are allocated as usual.
+//
+// Apply it before any instances of the class exist. The instances of
+// a pooled class are not tracked by Python's cyclic garbage
+// collector, so reference cycles through them are never reclaimed.
+class pooled_instances : public def_visitor<pooled_instances>
+{
+ public:
+    explicit pooled_instances(std::size_t capacity)
+      : m_capacity(capacity)
+    {}
+
+ private:
+    friend class def_visitor_access;
+
+    template <class classT>
+    void visit(classT& c) const
+    {
+        typedef typename classT::metadata::holder holder;
+        c.enable_instance_pool_(
+            m_capacity, objects::additional_instance_size<holder>::value);
+    }
+
+    std::size_t m_capacity;
+};
+
+}} // namespace boost::python
+
+#endif // POOLED_INSTANCES_HPP
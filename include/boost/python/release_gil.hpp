@@ -0,0 +1,29 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef RELEASE_GIL_HPP
+# define RELEASE_GIL_HPP
+
+# include <boost/python/detail/prefix.hpp>
+
+# include <boost/python/default_call_policies.hpp>
+# include <boost/mpl/bool.hpp>
+
+namespace boost { namespace python { 
+
+// Releases the GIL while the wrapped C++ function runs: after all of
+// its arguments have been converted from Python, and until its result
+// is converted back. The function mustn't touch any Python object,
+// so it can't take arguments such as object, list or back_reference<>.
+//
+// For constructors wrapped with init<>, the GIL is released only
+// while the held C++ object is constructed.
+template <class BasePolicy_ = default_call_policies>
+struct release_gil : BasePolicy_
+{
+    typedef mpl::true_ releases_gil;
+};
+
+}} // namespace boost::python
+
+#endif // RELEASE_GIL_HPP
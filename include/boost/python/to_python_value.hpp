@@ -25,6 +25,8 @@
 # include <boost/mpl/if.hpp>
 # include <boost/mpl/or.hpp>
 # include <boost/type_traits/is_const.hpp>
+# include <boost/type_traits/remove_cv.hpp>
+# include <boost/type_traits/is_reference.hpp>
 
 namespace boost { namespace python { 
 
@@ -89,6 +91,24 @@ struct object_manager_get_pytype<true>
       typedef typename value_arg<T>::type argument_type;
     
       PyObject* operator()(argument_type) const;
+
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+      // Converts a temporary, such as the result of a function which
+      // returns by value, moving from it when the converter can.
+      // Types such as auto_ptr, which are already passed by value,
+      // are left alone.
+      struct no_rvalue_argument {};
+
+      typedef typename mpl::if_<
+          is_reference<argument_type>
+        , typename remove_cv<
+              typename remove_reference<T>::type
+          >::type&&
+        , no_rvalue_argument
+      >::type rvalue_argument_type;
+
+      PyObject* operator()(rvalue_argument_type) const;
+# endif
 #ifndef BOOST_PYTHON_NO_PY_SIGNATURES
       PyTypeObject const* get_pytype() const {return converter::registered<T>::converters.to_python_target_type();}
 #endif
@@ -155,6 +175,14 @@ namespace detail
       return converter::registered<argument_type>::converters.to_python(&x);
   }
 
+# ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+  template <class T>
+  inline PyObject* registry_to_python_value<T>::operator()(rvalue_argument_type x) const
+  {
+      return converter::registered<argument_type>::converters.to_python_move(&x);
+  }
+# endif
+
   template <class T>
   inline PyObject* object_manager_to_python_value<T>::operator()(argument_type x) const
   {
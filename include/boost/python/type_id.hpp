@@ -11,6 +11,7 @@
 # include <boost/operators.hpp>
 # include <typeinfo>
 # include <cstring>
+# include <cstddef>
 # include <ostream>
 # include <boost/static_assert.hpp>
 # include <boost/detail/workaround.hpp>
@@ -45,6 +46,14 @@ bool cxxabi_cxa_demangle_is_broken();
 #define BOOST_PYTHON_HAVE_CXXABI_CXA_DEMANGLE_IS_BROKEN
 #endif
 
+namespace detail
+{
+  // Returns the canonical id of the type described by id. Every
+  // std::type_info object describing the same type, in any shared
+  // library, gets the same small nonzero integer.
+  BOOST_PYTHON_DECL std::size_t intern_type_id(std::type_info const& id);
+}
+
 // type ids which represent the same information as std::type_info
 // (i.e. the top-level reference and cv-qualifiers are stripped), but
 // which works across shared libraries.
@@ -52,9 +61,15 @@ struct type_info : private totally_ordered<type_info>
 {
     inline type_info(std::type_info const& = typeid(void));
     
+    // Types are ordered by their interned ids, which is consistent
+    // within a process but otherwise arbitrary.
     inline bool operator<(type_info const& rhs) const;
     inline bool operator==(type_info const& rhs) const;
 
+    // A hash consistent with operator==. Interned ids are allocated
+    // sequentially, so the id itself serves.
+    inline std::size_t hash() const;
+
     char const* name() const;
     friend BOOST_PYTHON_DECL std::ostream& operator<<(
         std::ostream&, type_info const&);
@@ -67,6 +82,7 @@ struct type_info : private totally_ordered<type_info>
 #  endif
     
     base_id_t m_base_type;
+    std::size_t m_id;
 };
 
 #  ifdef BOOST_NO_EXPLICIT_FUNCTION_TEMPLATE_ARGUMENTS
@@ -78,7 +94,8 @@ struct type_info : private totally_ordered<type_info>
 template <class T>
 inline type_info type_id(BOOST_EXPLICIT_TEMPLATE_TYPE(T))
 {
-    return type_info(
+    // Intern each type only once
+    static type_info const result(
 #  if !defined(_MSC_VER)                                       \
       || (!BOOST_WORKAROUND(BOOST_MSVC, <= 1300)                \
           && !BOOST_WORKAROUND(BOOST_INTEL_CXX_VERSION, <= 700))
@@ -87,6 +104,7 @@ inline type_info type_id(BOOST_EXPLICIT_TEMPLATE_TYPE(T))
         python::detail::msvc_typeid((boost::type<T>*)0)
 #  endif 
         );
+    return result;
 }
 
 #  if (defined(__EDG_VERSION__) && __EDG_VERSION__ < 245) \
@@ -124,25 +142,23 @@ inline type_info::type_info(std::type_info const& id)
         &id
 #  endif
         )
+    , m_id(detail::intern_type_id(id))
 {
 }
 
 inline bool type_info::operator<(type_info const& rhs) const
 {
-#  ifdef BOOST_PYTHON_TYPE_ID_NAME
-    return std::strcmp(m_base_type, rhs.m_base_type) < 0;
-#  else
-    return m_base_type->before(*rhs.m_base_type);
-#  endif 
+    return m_id < rhs.m_id;
 }
 
 inline bool type_info::operator==(type_info const& rhs) const
 {
-#  ifdef BOOST_PYTHON_TYPE_ID_NAME
-    return !std::strcmp(m_base_type, rhs.m_base_type);
-#  else
-    return *m_base_type == *rhs.m_base_type;
-#  endif 
+    return m_id == rhs.m_id;
+}
+
+inline std::size_t type_info::hash() const
+{
+    return m_id;
 }
 
 #  ifdef BOOST_PYTHON_HAVE_GCC_CP_DEMANGLE
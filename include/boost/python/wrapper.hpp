@@ -11,7 +11,11 @@
 
 namespace boost { namespace python { 
 
-template <class T>
+// With Mode == acquire_gil, get_override() may be called from threads
+// which don't hold the GIL. The GIL is then held, and other threads
+// calling into Python are kept waiting, for as long as the returned
+// override lives, which is usually until its result is converted.
+template <class T, gil_mode Mode>
 class wrapper : public detail::wrapper_base
 {
  public:
@@ -20,13 +24,15 @@ class wrapper : public detail::wrapper_base
 
  protected:
     override get_override(char const* name) const
+    {
+        return this->get_override(name, Mode);
+    }
+
+    override get_override(char const* name, gil_mode mode) const
     {
         typedef detail::wrapper_base base;
-        converter::registration const& r
-            = converter::registered<T>::converters;
-        PyTypeObject* type = r.get_class_object();
-        
-        return this->base::get_override(name, type);
+        return this->base::get_override(
+            name, converter::registered<T>::converters, mode);
     }
 };
 
@@ -0,0 +1,90 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/converter/buffer_from_python.hpp>
+
+#include <cstring>
+
+namespace boost { namespace python { namespace converter {
+
+namespace
+{
+  bool is_little_endian()
+  {
+      unsigned short const one = 1;
+      return *reinterpret_cast<unsigned char const*>(&one) == 1;
+  }
+}
+
+BOOST_PYTHON_DECL bool buffer_format_matches(
+    char const* format, Py_ssize_t itemsize, char kind, std::size_t size)
+{
+    if (itemsize < 0 || static_cast<std::size_t>(itemsize) != size)
+        return false;
+
+    // A missing format means unsigned bytes
+    if (format == 0)
+        format = "B";
+
+    // Since the item size has been checked, only the byte order
+    // matters for the standard size prefixes.
+    switch (*format)
+    {
+    case '@': case '=':
+        ++format;
+        break;
+    case '<':
+        if (size > 1 && !is_little_endian())
+            return false;
+        ++format;
+        break;
+    case '>': case '!':
+        if (size > 1 && is_little_endian())
+            return false;
+        ++format;
+        break;
+    }
+
+    // Only single, unrepeated elements are supported
+    if (format[0] == 0 || format[1] != 0)
+        return false;
+
+    char const* codes;
+    switch (kind)
+    {
+    case 'f': codes = "fdg"; break;
+    case 'i': codes = "bhilqn"; break;
+    case 'u': codes = "BHILQN"; break;
+    case '?': codes = "?"; break;
+    case 'c': codes = "cbB"; break;
+    default: return false;
+    }
+    return std::strchr(codes, format[0]) != 0;
+}
+
+BOOST_PYTHON_DECL bool get_buffer(
+    PyObject* source, Py_buffer* view, bool writable, char kind, std::size_t size)
+{
+    if (!PyObject_CheckBuffer(source))
+        return false;
+
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (writable)
+        flags |= PyBUF_WRITABLE;
+
+    if (PyObject_GetBuffer(source, view, flags) != 0)
+    {
+        PyErr_Clear();
+        return false;
+    }
+
+    if (!buffer_format_matches(view->format, view->itemsize, kind, size))
+    {
+        PyBuffer_Release(view);
+        return false;
+    }
+    return true;
+}
+
+}}} // namespace boost::python::converter
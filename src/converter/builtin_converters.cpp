@@ -19,11 +19,66 @@
 #include <boost/python/converter/pytype_function.hpp>
 
 #include <boost/cast.hpp>
+#include <boost/utility/string_ref.hpp>
+#include <boost/weak_ptr.hpp>
+#include <map>
 #include <string>
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+# include <string_view>
+#endif
 #include <complex>
 
 namespace boost { namespace python { namespace converter {
 
+namespace
+{
+  // The control blocks handed out by get_shared_owner(), by owner.
+  // Entries are removed by the deleter once the last pointer sharing
+  // them is gone.
+  typedef std::map<PyObject*, boost::weak_ptr<void> > boost_owner_map;
+
+  boost_owner_map& boost_owners()
+  {
+      static boost_owner_map owners;
+      return owners;
+  }
+
+#ifndef BOOST_NO_CXX11_SMART_PTR
+  typedef std::map<PyObject*, std::weak_ptr<void> > std_owner_map;
+
+  std_owner_map& std_owners()
+  {
+      static std_owner_map owners;
+      return owners;
+  }
+#endif
+
+  template <class Map, class Pointer>
+  void get_shared_owner_impl(Map& owners, PyObject* owner, Pointer& result)
+  {
+      typename Map::iterator p = owners.lower_bound(owner);
+      if (p == owners.end() || p->first != owner)
+          p = owners.insert(p, typename Map::value_type(owner, typename Map::mapped_type()));
+
+      // The pointer is always null, so only use_count() tells whether
+      // the control block was still alive.
+      result = p->second.lock();
+      if (result.use_count() == 0)
+      {
+          result = Pointer((void*)0, shared_ptr_deleter(handle<>(borrowed(owner))));
+          p->second = result;
+      }
+  }
+
+  template <class Map>
+  void erase_expired_owner(Map& owners, PyObject* owner)
+  {
+      typename Map::iterator p = owners.find(owner);
+      if (p != owners.end() && p->second.expired())
+          owners.erase(p);
+  }
+}
+
 shared_ptr_deleter::shared_ptr_deleter(handle<> owner)
     : owner(owner)
 {}
@@ -32,9 +87,25 @@ shared_ptr_deleter::~shared_ptr_deleter() {}
 
 void shared_ptr_deleter::operator()(void const*)
 {
+    erase_expired_owner(boost_owners(), owner.get());
+#ifndef BOOST_NO_CXX11_SMART_PTR
+    erase_expired_owner(std_owners(), owner.get());
+#endif
     owner.reset();
 }
 
+BOOST_PYTHON_DECL void get_shared_owner(PyObject* owner, boost::shared_ptr<void>& result)
+{
+    get_shared_owner_impl(boost_owners(), owner, result);
+}
+
+#ifndef BOOST_NO_CXX11_SMART_PTR
+BOOST_PYTHON_DECL void get_shared_owner(PyObject* owner, std::shared_ptr<void>& result)
+{
+    get_shared_owner_impl(std_owners(), owner, result);
+}
+#endif
+
 namespace
 {
 
@@ -401,6 +472,83 @@ namespace
 #endif
   };
 
+#if PY_VERSION_HEX < 0x03000000 || PY_VERSION_HEX >= 0x03030000
+  // Python 3.0 - 3.2 have no way to borrow a UTF-8 representation
+# define BOOST_PYTHON_BORROWED_STRING_RANGE
+  
+  // Registers from_python converters to a type T which can be
+  // constructed from a pointer to a range of characters and its
+  // length, reading the characters directly out of the source object.
+  //
+  // For str objects, the range is the UTF-8 representation which the
+  // interpreter caches in the object itself, so no intermediate object
+  // is created. A T which doesn't own its characters (string_view,
+  // string_ref) borrows them, and so is only valid while the source
+  // object is alive; as a function argument, that is until the call
+  // returns.
+  template <class T>
+  struct string_range_rvalue_from_python
+  {
+   public:
+      string_range_rvalue_from_python()
+      {
+          registry::insert(
+              &string_range_rvalue_from_python<T>::convertible
+              , &string_range_rvalue_from_python<T>::construct
+              , type_id<T>()
+              , &string_range_rvalue_from_python<T>::get_pytype
+              );
+      }
+      
+   private:
+      static void* convertible(PyObject* obj)
+      {
+#if PY_VERSION_HEX >= 0x03000000
+          return PyUnicode_Check(obj) || PyBytes_Check(obj) ? obj : 0;
+#else
+          return PyString_Check(obj) ? obj : 0;
+#endif
+      }
+
+      static void construct(PyObject* obj, rvalue_from_python_stage1_data* data)
+      {
+          char const* chars;
+          Py_ssize_t size;
+#if PY_VERSION_HEX >= 0x03000000
+          if (PyUnicode_Check(obj))
+          {
+              chars = PyUnicode_AsUTF8AndSize(obj, &size);
+              if (chars == 0)
+                  throw_error_already_set();
+          }
+          else
+          {
+              chars = PyBytes_AS_STRING(obj);
+              size = PyBytes_GET_SIZE(obj);
+          }
+#else
+          chars = PyString_AS_STRING(obj);
+          size = PyString_GET_SIZE(obj);
+#endif
+          
+          void* storage = ((rvalue_from_python_storage<T>*)data)->storage.bytes;
+          new (storage) T(chars, static_cast<typename T::size_type>(size));
+          
+          // record successful construction
+          data->convertible = storage;
+      }
+
+      static PyTypeObject const* get_pytype()
+      {
+#if PY_VERSION_HEX >= 0x03000000
+          return &PyUnicode_Type;
+#else
+          return &PyString_Type;
+#endif
+      }
+  };
+#endif // BOOST_PYTHON_BORROWED_STRING_RANGE
+
 #if defined(Py_USING_UNICODE) && !defined(BOOST_NO_STD_WSTRING)
   // encode_string_unaryfunc/py_encode_string -- manufacture a unaryfunc
   // "slot" which encodes a Python string using the default encoding
@@ -563,7 +711,15 @@ void initialize_builtin_converters()
 #if defined(Py_USING_UNICODE) && !defined(BOOST_NO_STD_WSTRING)
     slot_rvalue_from_python<std::wstring, wstring_rvalue_from_python>();
 # endif 
+#ifdef BOOST_PYTHON_BORROWED_STRING_RANGE
+    string_range_rvalue_from_python<std::string>();
+    string_range_rvalue_from_python<boost::string_ref>();
+# ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    string_range_rvalue_from_python<std::string_view>();
+# endif
+#else
     slot_rvalue_from_python<std::string, string_rvalue_from_python>();
+#endif 
 
 }
 
@@ -18,6 +18,36 @@
 
 namespace boost { namespace python { namespace converter { 
 
+namespace
+{
+  // Returns the cache entry for source_type, or 0 if there is none
+  inline rvalue_from_python_cache_entry* find_rvalue_cache_entry(
+      registration const& converters, PyTypeObject const* source_type)
+  {
+      for (unsigned i = 0; i < registration::rvalue_cache_size; ++i)
+      {
+          if (converters.m_rvalue_cache[i].source_type == source_type)
+              return &converters.m_rvalue_cache[i];
+      }
+      return 0;
+  }
+
+  inline void cache_rvalue_converter(
+      registration const& converters
+      , rvalue_from_python_cache_entry* entry
+      , PyTypeObject const* source_type
+      , rvalue_from_python_chain const* converter)
+  {
+      if (entry == 0)
+      {
+          entry = &converters.m_rvalue_cache[
+              converters.m_rvalue_cache_next++ % registration::rvalue_cache_size];
+      }
+      entry->source_type = source_type;
+      entry->converter = converter;
+  }
+}
+
 // rvalue_from_python_stage1 -- do the first stage of a conversion
 // from a Python object to a C++ rvalue.
 //
@@ -45,17 +75,47 @@ BOOST_PYTHON_DECL rvalue_from_python_stage1_data rvalue_from_python_stage1(
     // instance, as a special case.
     data.convertible = objects::find_instance_impl(source, converters.target_type, converters.is_shared_ptr);
         data.construct = 0;
-    if (!data.convertible)
+    if (!data.convertible && converters.rvalue_chain != 0)
     {
+        // With several converters to choose from, first try the one
+        // which last succeeded for a source of the same Python type. Its
+        // convertible function is still called, since converters may
+        // accept some objects of a type and not others.
+        bool use_cache = converters.rvalue_chain->next != 0;
+        PyTypeObject const* source_type = Py_TYPE(source);
+        rvalue_from_python_cache_entry* entry = 0;
+        rvalue_from_python_chain const* cached = 0;
+        
+        if (use_cache)
+        {
+            entry = find_rvalue_cache_entry(converters, source_type);
+            if (entry != 0)
+            {
+                cached = entry->converter;
+                void* r = cached->convertible(source);
+                if (r != 0)
+                {
+                    data.convertible = r;
+                    data.construct = cached->construct;
+                    return data;
+                }
+            }
+        }
+        
         for (rvalue_from_python_chain const* chain = converters.rvalue_chain;
              chain != 0;
              chain = chain->next)
         {
+            if (chain == cached)
+                continue;
+            
             void* r = chain->convertible(source);
             if (r != 0)
             {
                 data.convertible = r;
                 data.construct = chain->construct;
+                if (use_cache)
+                    cache_rvalue_converter(converters, entry, source_type, chain);
                 break;
             }
         }
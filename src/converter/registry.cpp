@@ -6,7 +6,10 @@
 #include <boost/python/converter/registrations.hpp>
 #include <boost/python/converter/builtin_converters.hpp>
 
+#include <boost/noncopyable.hpp>
+
 #include <set>
+#include <vector>
 #include <stdexcept>
 
 #if defined(__APPLE__) && defined(__MACH__) && defined(__GNUC__) \
@@ -91,6 +94,13 @@ BOOST_PYTHON_DECL PyObject* registration::to_python(void const volatile* source)
         : this->m_to_python(const_cast<void*>(source));
 }
 
+BOOST_PYTHON_DECL PyObject* registration::to_python_move(void* source) const
+{
+    return this->m_to_python_move != 0
+        ? this->m_to_python_move(source)
+        : this->to_python(source);
+}
+
 namespace
 {
   template< typename T >
@@ -112,8 +122,92 @@ registration::~registration()
 namespace // <unnamed>
 {
   typedef registration entry;
-  
-  typedef std::set<entry> registry_t;
+
+  // An open-addressing hash table of registrations keyed on their
+  // target type. Entries are never removed and are allocated
+  // individually, so references to them remain valid.
+  class registry_t : boost::noncopyable
+  {
+   public:
+      // Iterates over the registrations in the order they were created
+      typedef std::vector<entry*>::const_iterator iterator;
+
+      ~registry_t()
+      {
+          for (iterator p = begin(); p != end(); ++p)
+              delete *p;
+      }
+
+      iterator begin() const { return m_entries.begin(); }
+      iterator end() const { return m_entries.end(); }
+
+      // Returns the registration for type, or 0 if there is none
+      entry* find(type_info type) const
+      {
+          return m_slots.empty() ? 0 : m_slots[probe(type, type.hash())].value;
+      }
+
+      // Returns the registration for type, creating it if necessary
+      entry* insert(type_info type, bool is_shared_ptr)
+      {
+          std::size_t hash = type.hash();
+          if (!m_slots.empty())
+          {
+              if (entry* found = m_slots[probe(type, hash)].value)
+                  return found;
+          }
+
+          // Keep the load factor at or below 1/2
+          if (2 * (m_entries.size() + 1) > m_slots.size())
+              grow();
+
+          // Reserve first so that push_back() cannot throw and leak
+          m_entries.reserve(m_entries.size() + 1);
+          entry* result = new entry(type, is_shared_ptr);
+          m_entries.push_back(result);
+          
+          slot& s = m_slots[probe(type, hash)];
+          s.hash = hash;
+          s.value = result;
+          return result;
+      }
+
+   private:
+      struct slot
+      {
+          std::size_t hash;
+          entry* value;
+      };
+
+      // Returns the index of the slot holding type, or of the empty
+      // slot where it belongs.
+      std::size_t probe(type_info type, std::size_t hash) const
+      {
+          std::size_t mask = m_slots.size() - 1;
+          for (std::size_t i = hash & mask;; i = (i + 1) & mask)
+          {
+              slot const& s = m_slots[i];
+              if (s.value == 0 || (s.hash == hash && s.value->target_type == type))
+                  return i;
+          }
+      }
+
+      void grow()
+      {
+          slot empty = { 0, 0 };
+          std::vector<slot> old(m_slots.empty() ? 64 : 2 * m_slots.size(), empty);
+          old.swap(m_slots);
+          
+          for (std::vector<slot>::const_iterator p = old.begin(); p != old.end(); ++p)
+          {
+              if (p->value != 0)
+                  m_slots[probe(p->value->target_type, p->hash)] = *p;
+          }
+      }
+      
+      std::vector<slot> m_slots;    // size is zero or a power of 2
+      std::vector<entry*> m_entries;
+  };
   
 #ifndef BOOST_PYTHON_CONVERTER_REGISTRY_APPLE_MACH_WORKAROUND
   registry_t& entries()
@@ -134,7 +228,7 @@ namespace // <unnamed>
       std::cout << "registry: ";
       for (registry_t::iterator p = registry.begin(); p != registry.end(); ++p)
       {
-          std::cout << p->target_type << "; ";
+          std::cout << (*p)->target_type << "; ";
       }
       std::cout << '\n';
 #  endif 
@@ -170,7 +264,7 @@ namespace // <unnamed>
       std::cout << "registry: ";
       for (registry_t::iterator p = static_registry().begin(); p != static_registry().end(); ++p)
       {
-          std::cout << p->target_type << "; ";
+          std::cout << (*p)->target_type << "; ";
       }
       std::cout << '\n';
 #  endif 
@@ -182,21 +276,11 @@ namespace // <unnamed>
   entry* get(type_info type, bool is_shared_ptr = false)
   {
 #  ifdef BOOST_PYTHON_TRACE_REGISTRY
-      registry_t::iterator p = entries().find(entry(type));
-      
       std::cout << "looking up " << type << ": "
-                << (p == entries().end() || p->target_type != type
+                << (entries().find(type) == 0
                     ? "...NOT found\n" : "...found\n");
 #  endif
-      std::pair<registry_t::const_iterator,bool> pos_ins
-          = entries().insert(entry(type,is_shared_ptr));
-      
-#  if __MWERKS__ >= 0x3000
-      // do a little invariant checking if a change was made
-      if ( pos_ins.second )
-          assert(entries().invariants());
-#  endif
-      return const_cast<entry*>(&*pos_ins.first);
+      return entries().insert(type, is_shared_ptr);
   }
 } // namespace <unnamed>
 
@@ -227,6 +311,11 @@ namespace registry
       slot->m_to_python_target_type = to_python_target_type;
   }
 
+  void insert_move(to_python_function_t f, type_info source_t)
+  {
+      get(source_t)->m_to_python_move = f;
+  }
+
   // Insert an lvalue from_python converter
   void insert(convertible_function convert, type_info key, PyTypeObject const* (*exp_pytype)())
   {
@@ -258,6 +347,7 @@ namespace registry
       registration->expected_pytype = exp_pytype;
       registration->next = found->rvalue_chain;
       found->rvalue_chain = registration;
+      found->clear_rvalue_cache();
   }
 
   // Insert an rvalue from_python converter
@@ -269,7 +359,8 @@ namespace registry
 #  ifdef BOOST_PYTHON_TRACE_REGISTRY
       std::cout << "push_back rvalue from_python " << key << "\n";
 #  endif 
-      rvalue_from_python_chain** found = &get(key)->rvalue_chain;
+      entry* slot = get(key);
+      rvalue_from_python_chain** found = &slot->rvalue_chain;
       while (*found != 0)
           found = &(*found)->next;
       
@@ -279,6 +370,7 @@ namespace registry
       registration->expected_pytype = exp_pytype;
       registration->next = 0;
       *found = registration;
+      slot->clear_rvalue_cache();
   }
 
   registration const& lookup(type_info key)
@@ -293,13 +385,12 @@ namespace registry
 
   registration const* query(type_info type)
   {
-      registry_t::iterator p = entries().find(entry(type));
+      entry* p = entries().find(type);
 #  ifdef BOOST_PYTHON_TRACE_REGISTRY
       std::cout << "querying " << type
-                << (p == entries().end() || p->target_type != type
-                    ? "...NOT found\n" : "...found\n");
+                << (p == 0 ? "...NOT found\n" : "...found\n");
 #  endif 
-      return (p == entries().end() || p->target_type != type) ? 0 : &*p;
+      return p;
   }
 } // namespace registry
 
@@ -12,6 +12,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <boost/noncopyable.hpp>
+
 #if defined(__QNXNTO__)
 # include <ostream>
 #else                       /*  defined(__QNXNTO__) */
@@ -190,6 +192,126 @@ namespace detail
 }
 #  endif
 
+namespace
+{
+  struct type_slot
+  {
+      std::type_info const* key;
+      std::size_t hash;
+      std::size_t id;
+  };
+
+  // An open-addressing hash table from std::type_info objects to
+  // interned ids. Equal decides whether two keys are the same.
+  template <class Equal>
+  class type_id_table : boost::noncopyable
+  {
+   public:
+      type_id_table() : m_size(0) {}
+      
+      // Returns the id stored for key, or 0 if there is none
+      std::size_t find(std::type_info const& key, std::size_t hash) const
+      {
+          return m_slots.empty() ? 0 : m_slots[probe(key, hash)].id;
+      }
+
+      // Precondition: find(key, hash) == 0
+      void insert(std::type_info const& key, std::size_t hash, std::size_t id)
+      {
+          // Keep the load factor at or below 1/2
+          if (2 * (m_size + 1) > m_slots.size())
+              grow();
+          
+          type_slot& s = m_slots[probe(key, hash)];
+          s.key = &key;
+          s.hash = hash;
+          s.id = id;
+          ++m_size;
+      }
+
+   private:
+      std::size_t probe(std::type_info const& key, std::size_t hash) const
+      {
+          std::size_t mask = m_slots.size() - 1;
+          for (std::size_t i = hash & mask;; i = (i + 1) & mask)
+          {
+              type_slot const& s = m_slots[i];
+              if (s.id == 0 || (s.hash == hash && Equal()(*s.key, key)))
+                  return i;
+          }
+      }
+
+      void grow()
+      {
+          type_slot empty = { 0, 0, 0 };
+          std::vector<type_slot> old(m_slots.empty() ? 64 : 2 * m_slots.size(), empty);
+          old.swap(m_slots);
+          
+          for (std::vector<type_slot>::const_iterator p = old.begin(); p != old.end(); ++p)
+          {
+              if (p->id != 0)
+                  m_slots[probe(*p->key, p->hash)] = *p;
+          }
+      }
+      
+      std::vector<type_slot> m_slots;    // size is zero or a power of 2
+      std::size_t m_size;
+  };
+
+  struct same_object
+  {
+      bool operator()(std::type_info const& x, std::type_info const& y) const
+      {
+          return &x == &y;
+      }
+  };
+
+  struct same_type
+  {
+      bool operator()(std::type_info const& x, std::type_info const& y) const
+      {
+#  ifdef BOOST_PYTHON_TYPE_ID_NAME
+          return &x == &y || !std::strcmp(x.name(), y.name());
+#  else
+          return x == y;
+#  endif 
+      }
+  };
+}
+
+namespace detail
+{
+  BOOST_PYTHON_DECL std::size_t intern_type_id(std::type_info const& id)
+  {
+      // Most lookups are for a std::type_info object which has been
+      // seen before, and are resolved by its address alone. Only the
+      // first lookup through each object hashes the type name to find
+      // out whether another shared library has already interned it.
+      static type_id_table<same_object> by_address;
+      static type_id_table<same_type> by_name;
+      static std::size_t next_id = 1;
+
+      std::size_t address_hash = reinterpret_cast<std::size_t>(&id) >> 3;
+      std::size_t result = by_address.find(id, address_hash);
+      if (result != 0)
+          return result;
+
+      // FNV-1a
+      std::size_t name_hash = 2166136261u;
+      for (char const* s = id.name(); *s; ++s)
+          name_hash = (name_hash ^ static_cast<unsigned char>(*s)) * 16777619u;
+      
+      result = by_name.find(id, name_hash);
+      if (result == 0)
+      {
+          result = next_id++;
+          by_name.insert(id, name_hash, result);
+      }
+      by_address.insert(id, address_hash, result);
+      return result;
+  }
+}
+
 BOOST_PYTHON_DECL std::ostream& operator<<(std::ostream& os, type_info const& x)
 {
     return os << x.name();
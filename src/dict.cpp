@@ -24,6 +24,21 @@ namespace
   {
       return  p->ptr()->ob_type == &PyDict_Type;
   }
+
+  // Looks up k in the exact dict self, returning d if it's missing.
+  // Unlike PyDict_GetItem, errors raised by k's __hash__ or __eq__
+  // are propagated.
+  object get_item(PyObject* self, object const& k, PyObject* d)
+  {
+#if PY_VERSION_HEX >= 0x03000000
+      PyObject* result = PyDict_GetItemWithError(self, k.ptr());
+      if (result == 0 && PyErr_Occurred())
+          throw_error_already_set();
+#else
+      PyObject* result = PyDict_GetItem(self, k.ptr());
+#endif
+      return object(detail::borrowed_reference(result ? result : d));
+  }
 }
 
 detail::new_reference dict_base::call(object const& arg_)
@@ -68,8 +83,7 @@ object dict_base::get(object_cref k) const
 {
     if (check_exact(this))
     {
-        PyObject* result = PyDict_GetItem(this->ptr(),k.ptr());
-        return object(detail::borrowed_reference(result ? result : Py_None));
+        return get_item(this->ptr(), k, Py_None);
     }
     else
     {
@@ -79,7 +93,14 @@ object dict_base::get(object_cref k) const
 
 object dict_base::get(object_cref k, object_cref d) const
 {
-    return this->attr("get")(k,d);
+    if (check_exact(this))
+    {
+        return get_item(this->ptr(), k, d.ptr());
+    }
+    else
+    {
+        return this->attr("get")(k,d);
+    }
 }
 
 bool dict_base::has_key(object_cref k) const
@@ -137,11 +158,19 @@ tuple dict_base::popitem()
 
 object dict_base::setdefault(object_cref k)
 {
-    return this->attr("setdefault")(k);
+    return this->setdefault(k, object());
 }
 
 object dict_base::setdefault(object_cref k, object_cref d)
 {
+#if PY_VERSION_HEX >= 0x03040000
+    if (check_exact(this))
+    {
+        return object(detail::borrowed_reference(
+                          expect_non_null(
+                              PyDict_SetDefault(this->ptr(), k.ptr(), d.ptr()))));
+    }
+#endif
     return this->attr("setdefault")(k,d);
 }
 
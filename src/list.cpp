@@ -7,6 +7,48 @@
 
 namespace boost { namespace python { namespace detail {
 
+namespace
+{
+  // Returns the index of the first item of the exact list self which
+  // compares equal to value, or -1 if there's none.
+  ssize_t find(PyObject* self, object const& value)
+  {
+      for (ssize_t i = 0; i < PyList_GET_SIZE(self); ++i)
+      {
+          // The comparison may mutate the list, so hold on to the item
+          object item(detail::borrowed_reference(PyList_GET_ITEM(self, i)));
+          int cmp = PyObject_RichCompareBool(item.ptr(), value.ptr(), Py_EQ);
+          if (cmp < 0)
+              throw_error_already_set();
+          if (cmp > 0)
+              return i;
+      }
+      return -1;
+  }
+
+  // Removes and returns the item of the exact list self at index,
+  // which may be negative.
+  object pop_item(PyObject* self, ssize_t index)
+  {
+      ssize_t size = PyList_GET_SIZE(self);
+      if (size == 0)
+      {
+          PyErr_SetString(PyExc_IndexError, "pop from empty list");
+          throw_error_already_set();
+      }
+      if (index < 0)
+          index += size;
+      if (index < 0 || index >= size)
+      {
+          PyErr_SetString(PyExc_IndexError, "pop index out of range");
+          throw_error_already_set();
+      }
+      object result(detail::borrowed_reference(PyList_GET_ITEM(self, index)));
+      if (PyList_SetSlice(self, index, index + 1, 0) == -1)
+          throw_error_already_set();
+      return result;
+  }
+}
 
 detail::new_non_null_reference list_base::call(object const& arg_)
 {
@@ -42,11 +84,35 @@ void list_base::append(object_cref x)
 
 void list_base::extend(object_cref sequence)
 {
-    this->attr("extend")(sequence);
+    if (PyList_CheckExact(this->ptr()))
+    {
+        ssize_t size = PyList_GET_SIZE(this->ptr());
+        if (PyList_SetSlice(this->ptr(), size, size, sequence.ptr()) == -1)
+            throw_error_already_set();
+    }
+    else
+    {
+        this->attr("extend")(sequence);
+    }
 }
 
 long list_base::index(object_cref value) const
 {
+    if (PyList_CheckExact(this->ptr()))
+    {
+        ssize_t result = find(this->ptr(), value);
+        if (result == -1)
+        {
+#if PY_VERSION_HEX >= 0x03000000
+            PyErr_Format(PyExc_ValueError, "%R is not in list", value.ptr());
+#else
+            PyErr_SetString(PyExc_ValueError, "list.index(x): x not in list");
+#endif
+            throw_error_already_set();
+        }
+        return result;
+    }
+
     object result_obj(this->attr("index")(value));
 #if PY_VERSION_HEX >= 0x03000000
     ssize_t result = PyLong_AsSsize_t(result_obj.ptr());
@@ -85,11 +151,15 @@ void list_base::insert(object const& index, object_cref x)
 
 object list_base::pop()
 {
+    if (PyList_CheckExact(this->ptr()))
+        return pop_item(this->ptr(), -1);
     return this->attr("pop")();
 }
 
 object list_base::pop(ssize_t index)
 {
+    if (PyList_CheckExact(this->ptr()))
+        return pop_item(this->ptr(), index);
     return this->pop(object(index));
 }
 
@@ -100,7 +170,21 @@ object list_base::pop(object const& index)
 
 void list_base::remove(object_cref value)
 {
-    this->attr("remove")(value);
+    if (PyList_CheckExact(this->ptr()))
+    {
+        ssize_t index = find(this->ptr(), value);
+        if (index == -1)
+        {
+            PyErr_SetString(PyExc_ValueError, "list.remove(x): x not in list");
+            throw_error_already_set();
+        }
+        if (PyList_SetSlice(this->ptr(), index, index + 1, 0) == -1)
+            throw_error_already_set();
+    }
+    else
+    {
+        this->attr("remove")(value);
+    }
 }
     
 void list_base::reverse()
@@ -146,6 +230,20 @@ void list_base::sort(object_cref cmpfunc)
 // with vc6.
 ssize_t list_base::count(object_cref value) const
 {
+    if (PyList_CheckExact(this->ptr()))
+    {
+        ssize_t result = 0;
+        for (ssize_t i = 0; i < PyList_GET_SIZE(this->ptr()); ++i)
+        {
+            object item(detail::borrowed_reference(PyList_GET_ITEM(this->ptr(), i)));
+            int cmp = PyObject_RichCompareBool(item.ptr(), value.ptr(), Py_EQ);
+            if (cmp < 0)
+                throw_error_already_set();
+            result += cmp;
+        }
+        return result;
+    }
+
     object result_obj(this->attr("count")(value));
 #if PY_VERSION_HEX >= 0x03000000
     ssize_t result = PyLong_AsSsize_t(result_obj.ptr());
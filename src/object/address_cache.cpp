@@ -0,0 +1,33 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/object/address_cache.hpp>
+#include <boost/python/refcount.hpp>
+
+namespace boost { namespace python { namespace objects { 
+
+PyObject* address_cache::find(void const* p) const
+{
+    map_type::const_iterator i = m_wrappers.find(p);
+
+    // A wrapper whose deallocation is running Python code (a weakref
+    // callback, say) must not be resurrected.
+    if (i == m_wrappers.end() || Py_REFCNT(i->second) == 0)
+        return 0;
+    return incref(i->second);
+}
+
+void address_cache::insert(void const* p, PyObject* wrapper)
+{
+    m_wrappers[p] = wrapper;
+}
+
+void address_cache::erase(void const* p)
+{
+    map_type::iterator i = m_wrappers.find(p);
+    if (i != m_wrappers.end() && Py_REFCNT(i->second) == 0)
+        m_wrappers.erase(i);
+}
+
+}}} // namespace boost::python::objects
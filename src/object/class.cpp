@@ -21,9 +21,11 @@
 #include <boost/python/dict.hpp>
 #include <boost/python/str.hpp>
 #include <boost/python/ssize_t.hpp>
+#include <algorithm>
 #include <functional>
 #include <vector>
 #include <cstddef>
+#include <cstring>
 #include <new>
 #include <structmember.h>
 
@@ -247,10 +249,128 @@ extern "C"
     }
 }
 
+namespace objects
+{
+  // A bounded free list of memory blocks for the instances of an
+  // extension class. Every block holds at least block_size bytes.
+  struct instance_pool
+  {
+      instance_pool(std::size_t capacity_, std::size_t block_size_)
+        : capacity(capacity_), block_size(block_size_), hits(0), misses(0)
+      {
+          blocks.reserve(capacity);
+      }
+
+      std::vector<void*> blocks;
+      std::size_t capacity;
+      std::size_t block_size;
+      std::size_t hits;   // allocations served from the free list
+      std::size_t misses; // allocations which went to PyObject_Malloc
+  };
+
+  // The layout of extension class objects, i.e. of instances of
+  // class_metatype_object: a heap type followed by the number of
+  // bytes to reserve in each instance for holding C++ objects, and
+  // the pool its instances are allocated from, if any.
+  struct class_object
+  {
+      PyHeapTypeObject type;
+      std::size_t instance_size;
+      instance_pool* pool;
+  };
+
+  // Takes the instances of the extension class t, of which there
+  // must be none yet, out of the cyclic garbage collector's care.
+  inline void untrack_instances(PyTypeObject* t)
+  {
+      if (PyType_IS_GC(t))
+      {
+          t->tp_flags &= ~Py_TPFLAGS_HAVE_GC;
+          if (t->tp_free == PyObject_GC_Del)
+              t->tp_free = PyObject_Del;
+      }
+  }
+
+  // Returns the holder storage size recorded for the extension
+  // class t. The static class_type_object records none.
+  inline std::size_t instance_size(PyTypeObject* t)
+  {
+      return PyType_HasFeature(t, Py_TPFLAGS_HEAPTYPE)
+          ? reinterpret_cast<class_object*>(t)->instance_size : 0;
+  }
+}
+
+extern "C"
+{
+    // Allocates instances of classes with pooled_instances enabled.
+    // Requests which don't fit the pool's blocks are served by
+    // PyObject_Malloc; being larger, they can still be pooled once
+    // freed.
+    static PyObject* pooled_instance_alloc(PyTypeObject* type, ssize_t nitems)
+    {
+        objects::instance_pool& pool = *reinterpret_cast<objects::class_object*>(type)->pool;
+        std::size_t const size = _PyObject_VAR_SIZE(type, nitems + 1);
+
+        void* block;
+        if (size <= pool.block_size && !pool.blocks.empty())
+        {
+            ++pool.hits;
+            block = pool.blocks.back();
+            pool.blocks.pop_back();
+        }
+        else
+        {
+            ++pool.misses;
+            block = PyObject_Malloc((std::max)(size, pool.block_size));
+            if (block == 0)
+                return PyErr_NoMemory();
+        }
+
+        std::memset(block, 0, size);
+#if PY_VERSION_HEX < 0x03080000
+        // Since 3.8, PyObject_INIT_VAR takes this reference itself
+        Py_INCREF(type);
+#endif
+        return (PyObject*)PyObject_INIT_VAR((PyVarObject*)block, type, nitems);
+    }
+
+    static void pooled_instance_free(void* p)
+    {
+        objects::instance_pool& pool
+            = *reinterpret_cast<objects::class_object*>(Py_TYPE((PyObject*)p))->pool;
+
+        if (pool.blocks.size() < pool.capacity)
+            pool.blocks.push_back(p);
+        else
+            PyObject_Free(p);
+    }
+
+    static PyObject* class_get_instance_pool(PyObject* op, void*)
+    {
+        objects::instance_pool const* pool = PyType_HasFeature((PyTypeObject*)op, Py_TPFLAGS_HEAPTYPE)
+            ? reinterpret_cast<objects::class_object*>(op)->pool : 0;
+
+        if (pool == 0)
+            return python::detail::none();
+
+        return Py_BuildValue(
+            const_cast<char*>("{s:n,s:n,s:n,s:n}")
+          , "capacity", static_cast<ssize_t>(pool->capacity)
+          , "size", static_cast<ssize_t>(pool->blocks.size())
+          , "hits", static_cast<ssize_t>(pool->hits)
+          , "misses", static_cast<ssize_t>(pool->misses));
+    }
+}
+
+static PyGetSetDef class_metatype_getsets[] = {
+    {const_cast<char*>("__instance_pool__"), class_get_instance_pool, 0, 0, 0},
+    {0, 0, 0, 0, 0}
+};
+
 static PyTypeObject class_metatype_object = {
     PyVarObject_HEAD_INIT(NULL, 0)
     const_cast<char*>("Boost.Python.class"),
-    PyType_Type.tp_basicsize,
+    sizeof(objects::class_object),
     0,
     0,                                      /* tp_dealloc */
     0,                                      /* tp_print */
@@ -278,7 +398,7 @@ static PyTypeObject class_metatype_object = {
     0,                                      /* tp_iternext */
     0,                                      /* tp_methods */
     0,                                      /* tp_members */
-    0,                                      /* tp_getset */
+    class_metatype_getsets,                 /* tp_getset */
     0, //&PyType_Type,                           /* tp_base */
     0,                                      /* tp_dict */
     0,                                      /* tp_descr_get */
@@ -286,7 +406,7 @@ static PyTypeObject class_metatype_object = {
     0,                                      /* tp_dictoffset */
     0,                                      /* tp_init */
     0,                                      /* tp_alloc */
-    0, // filled in with type_new           /* tp_new */
+    0, // filled in by class_metatype()     /* tp_new */
     0, // filled in with __PyObject_GC_Del  /* tp_free */
     (inquiry)type_is_gc,                    /* tp_is_gc */
     0,                                      /* tp_bases */
@@ -299,6 +419,78 @@ static PyTypeObject class_metatype_object = {
 #endif
 };
 
+extern "C"
+{
+    // Creates an extension class. Classes derived in Python inherit
+    // the holder storage size of their extension class base, so that
+    // their instances can hold the same C++ objects in place.
+    static PyObject*
+    class_metatype_new(PyTypeObject* metatype, PyObject* args, PyObject* kw)
+    {
+        // Classes derived from compact classes are compact. They get
+        // an empty __slots__ unless they declare one, since a __dict__
+        // or __weakref__ slot would overlap the holders in their
+        // instances.
+        PyObject* compact_args = 0;
+        bool compact = false;
+        if (PyTuple_Check(args) && PyTuple_GET_SIZE(args) == 3)
+        {
+            PyObject* bases = PyTuple_GET_ITEM(args, 1);
+            PyObject* dict = PyTuple_GET_ITEM(args, 2);
+
+            if (PyTuple_Check(bases))
+            {
+                for (ssize_t i = 0; i < PyTuple_GET_SIZE(bases); ++i)
+                {
+                    PyObject* base = PyTuple_GET_ITEM(bases, i);
+                    if (PyType_Check(base)
+                        && PyType_IsSubtype(Py_TYPE(base), &class_metatype_object)
+                        && ((PyTypeObject*)base)->tp_dictoffset == 0)
+                    {
+                        compact = true;
+                    }
+                }
+            }
+
+            if (compact && PyDict_Check(dict) && PyDict_GetItemString(dict, "__slots__") == 0)
+            {
+                PyObject* slots = PyTuple_New(0);
+                PyObject* compact_dict = slots ? PyDict_Copy(dict) : 0;
+                if (compact_dict != 0
+                    && PyDict_SetItemString(compact_dict, "__slots__", slots) == 0)
+                {
+                    compact_args = PyTuple_Pack(3, PyTuple_GET_ITEM(args, 0), bases, compact_dict);
+                }
+                Py_XDECREF(compact_dict);
+                Py_XDECREF(slots);
+                if (compact_args == 0)
+                    return 0;
+                args = compact_args;
+            }
+        }
+
+        PyObject* result = PyType_Type.tp_new(metatype, args, kw);
+        Py_XDECREF(compact_args);
+        if (result != 0)
+        {
+            if (compact)
+            {
+                // Otherwise inherited from Boost.Python.instance
+                ((PyTypeObject*)result)->tp_dictoffset = 0;
+                objects::untrack_instances((PyTypeObject*)result);
+            }
+
+            PyTypeObject* base = ((PyTypeObject*)result)->tp_base;
+            if (base != 0 && PyType_IsSubtype(Py_TYPE(base), &class_metatype_object))
+            {
+                reinterpret_cast<objects::class_object*>(result)->instance_size
+                    = objects::instance_size(base);
+            }
+        }
+        return result;
+    }
+}
+
 // Install the instance data for a C++ object into a Python instance
 // object.
 void instance_holder::install(PyObject* self) throw()
@@ -318,6 +510,7 @@ namespace objects
       {
           Py_TYPE(&class_metatype_object) = &PyType_Type;
           class_metatype_object.tp_base = &PyType_Type;
+          class_metatype_object.tp_new = class_metatype_new;
           if (PyType_Ready(&class_metatype_object))
               return type_handle();
       }
@@ -339,11 +532,12 @@ namespace objects
           // Python 2.2.1 won't add weak references automatically when
           // tp_itemsize > 0, so we need to manage that
           // ourselves. Accordingly, we also have to clean up the
-          // weakrefs ourselves.
-          if (kill_me->weakrefs != NULL)
+          // weakrefs ourselves. Compact instances have neither.
+          if (Py_TYPE(inst)->tp_weaklistoffset != 0 && kill_me->weakrefs != NULL)
             PyObject_ClearWeakRefs(inst);
 
-          Py_XDECREF(kill_me->dict);
+          if (Py_TYPE(inst)->tp_dictoffset != 0)
+              Py_XDECREF(kill_me->dict);
           
           Py_TYPE(inst)->tp_free(inst);
       }
@@ -351,21 +545,8 @@ namespace objects
       static PyObject *
       instance_new(PyTypeObject* type_, PyObject* /*args*/, PyObject* /*kw*/)
       {
-          // Attempt to find the __instance_size__ attribute. If not present, no problem.
-          PyObject* d = type_->tp_dict;
-          PyObject* instance_size_obj = PyObject_GetAttrString(d, const_cast<char*>("__instance_size__"));
-
-          ssize_t instance_size = instance_size_obj ? 
-#if PY_VERSION_HEX >= 0x03000000
-              PyLong_AsSsize_t(instance_size_obj) : 0;
-#else
-              PyInt_AsLong(instance_size_obj) : 0;
-#endif
-          
-          if (instance_size < 0)
-              instance_size = 0;
-          
-          PyErr_Clear(); // Clear any errors that may have occurred.
+          // Reserve the holder storage recorded by set_instance_size
+          ssize_t instance_size = objects::instance_size(type_);
 
           instance<>* result = (instance<>*)type_->tp_alloc(type_, instance_size);
           if (result)
@@ -379,13 +560,25 @@ namespace objects
 #else
               result->ob_size =
 #endif
-                  -(static_cast<int>(offsetof(instance<>,storage) + instance_size));
+                  -(static_cast<int>(type_->tp_basicsize + instance_size));
           }
           return (PyObject*)result;
       }
 
+      // Reports that compact instances lack the given attribute
+      static PyObject* no_compact_attribute(PyObject* op, char const* name)
+      {
+          PyErr_Format(
+              PyExc_AttributeError, "'%.50s' object has no attribute '%s'"
+            , Py_TYPE(op)->tp_name, name);
+          return 0;
+      }
+
       static PyObject* instance_get_dict(PyObject* op, void*)
       {
+          if (Py_TYPE(op)->tp_dictoffset == 0)
+              return no_compact_attribute(op, "__dict__");
+
           instance<>* inst = downcast<instance<> >(op);
           if (inst->dict == 0)
               inst->dict = PyDict_New();
@@ -394,23 +587,32 @@ namespace objects
     
       static int instance_set_dict(PyObject* op, PyObject* dict, void*)
       {
+          if (Py_TYPE(op)->tp_dictoffset == 0)
+          {
+              no_compact_attribute(op, "__dict__");
+              return -1;
+          }
+
           instance<>* inst = downcast<instance<> >(op);
           python::xdecref(inst->dict);
           inst->dict = python::incref(dict);
           return 0;
       }
 
+      static PyObject* instance_get_weakrefs(PyObject* op, void*)
+      {
+          if (Py_TYPE(op)->tp_weaklistoffset == 0)
+              return no_compact_attribute(op, "__weakref__");
+
+          instance<>* inst = downcast<instance<> >(op);
+          return python::incref(inst->weakrefs ? inst->weakrefs : Py_None);
+      }
   }
 
 
   static PyGetSetDef instance_getsets[] = {
       {const_cast<char*>("__dict__"),  instance_get_dict,  instance_set_dict, NULL, 0},
-      {0, 0, 0, 0, 0}
-  };
-
-  
-  static PyMemberDef instance_members[] = {
-      {const_cast<char*>("__weakref__"), T_OBJECT, offsetof(instance<>, weakrefs), 0, 0},
+      {const_cast<char*>("__weakref__"),  instance_get_weakrefs,  0, NULL, 0},
       {0, 0, 0, 0, 0}
   };
 
@@ -444,7 +646,7 @@ namespace objects
       0,                                      /* tp_iter */
       0,                                      /* tp_iternext */
       0,                                      /* tp_methods */
-      instance_members,                       /* tp_members */
+      0,                                      /* tp_members */
       instance_getsets,                       /* tp_getset */
       0, //&PyBaseObject_Type,                /* tp_base */
       0,                                      /* tp_dict */
@@ -610,6 +812,7 @@ namespace objects
   
   void class_base::set_instance_size(std::size_t instance_size)
   {
+      reinterpret_cast<class_object*>(this->ptr())->instance_size = instance_size;
       this->attr("__instance_size__") = instance_size;
   }
   
@@ -678,6 +881,72 @@ namespace objects
       this->setattr("__init__", object(f));
   }
 
+  void class_base::enable_instance_pool_(std::size_t capacity, std::size_t holder_size)
+  {
+      PyTypeObject* type = downcast<PyTypeObject>(this->ptr());
+      class_object* self = reinterpret_cast<class_object*>(type);
+      std::size_t const block_size = _PyObject_VAR_SIZE(type, holder_size + 1);
+
+      if (self->pool == 0)
+      {
+          // Blocks can only be recycled if the garbage collector
+          // doesn't own their memory. Newer Pythons make every heap
+          // type collectable, but like Boost.Python.instance, the
+          // classes with pooled instances opt out again.
+          untrack_instances(type);
+          self->pool = new instance_pool(capacity, block_size);
+          type->tp_alloc = pooled_instance_alloc;
+          type->tp_free = pooled_instance_free;
+      }
+      else
+      {
+          instance_pool& pool = *self->pool;
+          if (block_size > pool.block_size)
+          {
+              // Pooled blocks may now be too small
+              std::for_each(pool.blocks.begin(), pool.blocks.end(), PyObject_Free);
+              pool.blocks.clear();
+              pool.block_size = block_size;
+          }
+
+          while (pool.blocks.size() > capacity)
+          {
+              PyObject_Free(pool.blocks.back());
+              pool.blocks.pop_back();
+          }
+          pool.capacity = capacity;
+          pool.blocks.reserve(capacity);
+      }
+  }
+
+  void class_base::make_instances_compact_()
+  {
+      PyTypeObject* type = downcast<PyTypeObject>(this->ptr());
+
+      // Classes derived from compact ones are already compact
+      if (type->tp_dictoffset == 0)
+          return;
+
+      for (ssize_t i = 0; i < PyTuple_GET_SIZE(type->tp_bases); ++i)
+      {
+          PyTypeObject* base = (PyTypeObject*)PyTuple_GET_ITEM(type->tp_bases, i);
+          if (base != &class_type_object && base->tp_dictoffset != 0)
+          {
+              PyErr_Format(
+                  PyExc_TypeError, "cannot make %s compact, since its base %s is not"
+                , type->tp_name, base->tp_name);
+              throw_error_already_set();
+          }
+      }
+
+      // Without a __dict__ or __weakref__, instances hold nothing the
+      // cyclic garbage collector could reach.
+      type->tp_basicsize = offsetof(instance<>,dict);
+      type->tp_dictoffset = 0;
+      type->tp_weaklistoffset = 0;
+      untrack_instances(type);
+  }
+
   void class_base::enable_pickling_(bool getstate_manages_dict)
   {
       setattr("__safe_for_unpickling__", object(true));
@@ -736,7 +1005,7 @@ void* instance_holder::allocate(PyObject* self_, std::size_t holder_offset, std:
     if (-Py_SIZE(self) >= total_size_needed)
     {
         // holder_offset should at least point into the variable-sized part
-        assert(holder_offset >= offsetof(objects::instance<>,storage));
+        assert(holder_offset >= static_cast<std::size_t>(Py_TYPE(self)->tp_basicsize));
 
         // Record the fact that the storage is occupied, noting where it starts
         Py_SIZE(self) = holder_offset;
@@ -0,0 +1,175 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/object/data_member.hpp>
+#include <boost/python/object/find_instance.hpp>
+#include <boost/python/errors.hpp>
+#include <boost/python/str.hpp>
+#include <structmember.h>
+#include <new>
+
+namespace boost { namespace python { namespace objects { 
+
+namespace
+{
+  struct data_member
+  {
+      PyObject_HEAD
+      type_info class_id;
+      std::ptrdiff_t offset;
+      data_member_getter get;
+      data_member_setter set;
+      PyObject* doc;
+  };
+
+  // Returns the address of self's member in the C++ object held by
+  // inst, or null with a Python error set if inst holds none.
+  void* find_member(data_member* self, PyObject* inst)
+  {
+      void* object = find_instance_impl(inst, self->class_id);
+      if (object == 0)
+      {
+          PyErr_Format(
+              PyExc_TypeError, "data member of %s objects doesn't apply to a '%.100s' object"
+            , self->class_id.name(), Py_TYPE(inst)->tp_name);
+          return 0;
+      }
+      return static_cast<char*>(object) + self->offset;
+  }
+
+  struct assign_member
+  {
+      assign_member(data_member* self_, void* field_, PyObject* value_)
+        : self(self_), field(field_), value(value_) {}
+
+      void operator()() const
+      {
+          self->set(field, value);
+      }
+
+      data_member* self;
+      void* field;
+      PyObject* value;
+  };
+}
+
+extern "C"
+{
+    static PyObject* data_member_descr_get(PyObject* op, PyObject* inst, PyObject*)
+    {
+        if (inst == 0 || inst == Py_None)
+            return python::incref(op);
+
+        data_member* self = reinterpret_cast<data_member*>(op);
+        void* field = find_member(self, inst);
+        return field ? self->get(field) : 0;
+    }
+
+    static int data_member_descr_set(PyObject* op, PyObject* inst, PyObject* value)
+    {
+        data_member* self = reinterpret_cast<data_member*>(op);
+        if (self->set == 0 || value == 0)
+        {
+            PyErr_SetString(
+                PyExc_AttributeError, value ? "can't set attribute" : "can't delete attribute");
+            return -1;
+        }
+
+        void* field = find_member(self, inst);
+        if (field == 0)
+            return -1;
+
+        return handle_exception(assign_member(self, field, value)) ? -1 : 0;
+    }
+
+    static void data_member_dealloc(PyObject* op)
+    {
+        data_member* self = reinterpret_cast<data_member*>(op);
+        Py_XDECREF(self->doc);
+        PyObject_Del(op);
+    }
+}
+
+static PyMemberDef data_member_members[] = {
+    {const_cast<char*>("__doc__"), T_OBJECT, offsetof(data_member, doc), READONLY, 0},
+    {0, 0, 0, 0, 0}
+};
+
+static PyTypeObject data_member_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    const_cast<char*>("Boost.Python.data_member"),
+    sizeof(data_member),
+    0,
+    data_member_dealloc,                    /* tp_dealloc */
+    0,                                      /* tp_print */
+    0,                                      /* tp_getattr */
+    0,                                      /* tp_setattr */
+    0,                                      /* tp_compare */
+    0,                                      /* tp_repr */
+    0,                                      /* tp_as_number */
+    0,                                      /* tp_as_sequence */
+    0,                                      /* tp_as_mapping */
+    0,                                      /* tp_hash */
+    0,                                      /* tp_call */
+    0,                                      /* tp_str */
+    0,                                      /* tp_getattro */
+    0,                                      /* tp_setattro */
+    0,                                      /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags */
+    0,                                      /* tp_doc */
+    0,                                      /* tp_traverse */
+    0,                                      /* tp_clear */
+    0,                                      /* tp_richcompare */
+    0,                                      /* tp_weaklistoffset */
+    0,                                      /* tp_iter */
+    0,                                      /* tp_iternext */
+    0,                                      /* tp_methods */
+    data_member_members,                    /* tp_members */
+    0,                                      /* tp_getset */
+    0,                                      /* tp_base */
+    0,                                      /* tp_dict */
+    data_member_descr_get,                  /* tp_descr_get */
+    data_member_descr_set,                  /* tp_descr_set */
+    0,                                      /* tp_dictoffset */
+    0,                                      /* tp_init */
+    0,                                      /* tp_alloc */
+    0,                                      /* tp_new */
+    0,                                      /* tp_free */
+    0,                                      /* tp_is_gc */
+    0,                                      /* tp_bases */
+    0,                                      /* tp_mro */
+    0,                                      /* tp_cache */
+    0,                                      /* tp_subclasses */
+    0,                                      /* tp_weaklist */
+#if PYTHON_API_VERSION >= 1012
+    0                                       /* tp_del */
+#endif
+};
+
+BOOST_PYTHON_DECL object make_data_member(
+    type_info class_id, std::ptrdiff_t offset
+  , data_member_getter get, data_member_setter set, char const* doc)
+{
+    if (Py_TYPE(&data_member_type) == 0)
+    {
+        Py_TYPE(&data_member_type) = &PyType_Type;
+        if (PyType_Ready(&data_member_type) < 0)
+            throw_error_already_set();
+    }
+
+    object doc_object = doc ? object(str(doc)) : object();
+
+    data_member* result = PyObject_New(data_member, &data_member_type);
+    if (result == 0)
+        throw_error_already_set();
+
+    new (&result->class_id) type_info(class_id);
+    result->offset = offset;
+    result->get = get;
+    result->set = set;
+    result->doc = python::incref(doc_object.ptr());
+    return object(handle<>(reinterpret_cast<PyObject*>(result)));
+}
+
+}}} // namespace boost::python::objects
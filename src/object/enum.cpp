@@ -14,6 +14,8 @@
 #include <boost/python/object_protocol.hpp>
 #include <structmember.h>
 
+#include <algorithm>
+
 namespace boost { namespace python { namespace objects {
 
 struct enum_object
@@ -139,6 +141,57 @@ static PyTypeObject enum_type_object = {
 #endif
 };
 
+enum_value_table::enum_value_table()
+    : m_first(0)
+{}
+
+namespace
+{
+  struct entry_less
+  {
+      template <class Entry>
+      bool operator()(Entry const& e, long value) const
+      {
+          return e.first < value;
+      }
+  };
+}
+
+PyObject* enum_value_table::find_sparse(long value) const
+{
+    std::vector<entry>::const_iterator p
+        = std::lower_bound(m_entries.begin(), m_entries.end(), value, entry_less());
+    return p != m_entries.end() && p->first == value ? p->second : 0;
+}
+
+void enum_value_table::insert(long value, PyObject* x)
+{
+    std::vector<entry>::iterator p
+        = std::lower_bound(m_entries.begin(), m_entries.end(), value, entry_less());
+    if (p != m_entries.end() && p->first == value)
+    {
+        Py_DECREF(p->second);
+        p->second = incref(x);
+    }
+    else
+    {
+        m_entries.insert(p, entry(value, incref(x)));
+    }
+
+    // Index the values directly unless that would leave the table
+    // mostly empty.
+    m_dense.clear();
+    unsigned long range = static_cast<unsigned long>(m_entries.back().first)
+        - static_cast<unsigned long>(m_entries.front().first);
+    if (range < 2 * m_entries.size() + 16)
+    {
+        m_first = m_entries.front().first;
+        m_dense.resize(range + 1);
+        for (p = m_entries.begin(); p != m_entries.end(); ++p)
+            m_dense[static_cast<unsigned long>(p->first) - static_cast<unsigned long>(m_first)] = p->second;
+    }
+}
+
 object module_prefix();
 
 namespace
@@ -187,9 +240,11 @@ enum_base::enum_base(
     , converter::convertible_function convertible
     , converter::constructor_function construct
     , type_info id
+    , enum_value_table& values
     , char const *doc
     )
     : object(new_enum_type(name, doc))
+    , m_values(&values)
 {
     converter::registration& converters
         = const_cast<converter::registration&>(
@@ -213,6 +268,7 @@ void enum_base::add_value(char const* name_, long value)
 
     dict d = extract<dict>(this->attr("values"))();
     d[value] = x;
+    m_values->insert(value, x.ptr());
 
     // Set the name field in the new enum instanec
     enum_object* p = downcast<enum_object>(x.ptr());
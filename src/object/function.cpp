@@ -22,9 +22,11 @@
 #include <boost/mpl/vector/vector10.hpp>
 
 #include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 #if BOOST_PYTHON_DEBUG_ERROR_MESSAGES
 # include <cstdio>
@@ -42,10 +44,52 @@ namespace boost { namespace python {
 
 namespace boost { namespace python { namespace objects { 
 
+namespace
+{
+  // Returns a new tuple holding argv[0..nargs)
+  handle<> argument_tuple(PyObject* const* argv, std::size_t nargs)
+  {
+      handle<> result(PyTuple_New(static_cast<ssize_t>(nargs)));
+      for (std::size_t i = 0; i < nargs; ++i)
+          PyTuple_SET_ITEM(result.get(), i, incref(argv[i]));
+      return result;
+  }
+}
+
+namespace
+{
+  // Storage for the arguments of a call, on the stack when they fit
+  class argument_array : boost::noncopyable
+  {
+   public:
+      explicit argument_array(std::size_t size)
+        : m_items(m_stack)
+      {
+          if (size > sizeof(m_stack)/sizeof(*m_stack))
+          {
+              m_heap.resize(size);
+              m_items = &m_heap[0];
+          }
+      }
+
+      PyObject** get() const { return m_items; }
+      
+   private:
+      PyObject* m_stack[BOOST_PYTHON_MAX_ARITY + 1];
+      std::vector<PyObject*> m_heap;
+      PyObject** m_items;
+  };
+}
+
 py_function_impl_base::~py_function_impl_base()
 {
 }
 
+PyObject* py_function_impl_base::operator()(PyObject* const* argv, unsigned nargs)
+{
+    return (*this)(argument_tuple(argv, nargs).get(), 0);
+}
+
 unsigned py_function_impl_base::max_arity() const
 {
     return this->min_arity();
@@ -53,6 +97,14 @@ unsigned py_function_impl_base::max_arity() const
 
 extern PyTypeObject function_type;
 
+#ifdef BOOST_PYTHON_HAS_VECTORCALL
+extern "C"
+{
+    static PyObject* function_vectorcall(
+        PyObject* func, PyObject* const* argv, size_t nargsf, PyObject* kwnames);
+}
+#endif
+
 function::function(
     py_function const& implementation
 #if BOOST_WORKAROUND(__EDG_VERSION__, == 245)
@@ -64,6 +116,7 @@ function::function(
     )
     : m_fn(implementation)
     , m_nkeyword_values(0)
+    , m_overload_cache_next(0)
 {
     if (names_and_defaults != 0)
     {
@@ -74,6 +127,7 @@ function::function(
 
         ssize_t tuple_size = num_keywords ? max_arity : 0;
         m_arg_names = object(handle<>(PyTuple_New(tuple_size)));
+        m_keywords.resize(tuple_size);
 
         if (num_keywords != 0)
         {
@@ -86,16 +140,32 @@ function::function(
             tuple kv;
 
             python::detail::keyword const* const p = names_and_defaults + i;
+            
+            // Interning the name makes binding a keyword argument
+            // usually a matter of comparing pointers
+            object name(
+                handle<>(
+#if PY_VERSION_HEX >= 0x03000000
+                    PyUnicode_InternFromString(p->name)
+#else
+                    PyString_InternFromString(p->name)
+#endif
+                ));
+            
             if (p->default_value)
             {
-                kv = make_tuple(p->name, p->default_value);
+                kv = make_tuple(name, p->default_value);
                 ++m_nkeyword_values;
             }
             else
             {
-                kv = make_tuple(p->name);
+                kv = make_tuple(name);
             }
 
+            // kv keeps the name and the default value alive
+            m_keywords[i + keyword_offset].name = name.ptr();
+            m_keywords[i + keyword_offset].default_value = p->default_value.get();
+
             PyTuple_SET_ITEM(
                 m_arg_names.ptr()
                 , i + keyword_offset
@@ -105,9 +175,18 @@ function::function(
     }
     
     PyObject* p = this;
+#ifdef BOOST_PYTHON_HAS_VECTORCALL
+    m_vectorcall = function_vectorcall;
+#endif 
     if (Py_TYPE(&function_type) == 0)
     {
         Py_TYPE(&function_type) = &PyType_Type;
+#ifdef BOOST_PYTHON_HAS_VECTORCALL
+        // function isn't a POD, so offsetof can't be used here
+        function_type.tp_vectorcall_offset
+            = reinterpret_cast<char*>(&m_vectorcall) - reinterpret_cast<char*>(p);
+        function_type.tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL;
+#endif 
         ::PyType_Ready(&function_type);
     }
     
@@ -126,6 +205,18 @@ PyObject* function::call(PyObject* args, PyObject* keywords) const
     std::size_t n_keyword_actual = keywords ? PyDict_Size(keywords) : 0;
     std::size_t n_actual = n_unnamed_actual + n_keyword_actual;
     
+    PyObject* const* argv = &PyTuple_GET_ITEM(args, 0);
+    if (n_keyword_actual == 0)
+    {
+        // Try the overload which last accepted these argument types
+        if (function const* cached = find_cached_overload(argv, n_actual))
+        {
+            PyObject* result = cached->m_fn(args, keywords);
+            if (result != 0 || PyErr_Occurred())
+                return result;
+        }
+    }
+    
     function const* f = this;
 
     // Try overloads looking for a match
@@ -138,92 +229,38 @@ PyObject* function::call(PyObject* args, PyObject* keywords) const
         if (n_actual + f->m_nkeyword_values >= min_arity
             && n_actual <= max_arity)
         {
-            // This will be the args that actually get passed
-            handle<>inner_args(allow_null(borrowed(args)));
-
-            if (n_keyword_actual > 0      // Keyword arguments were supplied
-                 || n_actual < min_arity) // or default keyword values are needed
-            {                            
-                if (f->m_arg_names.is_none())
-                {
-                    // this overload doesn't accept keywords
-                    inner_args = handle<>();
-                }
-                else
-                {
-                    // "all keywords are none" is a special case
-                    // indicating we will accept any number of keyword
-                    // arguments
-                    if (PyTuple_Size(f->m_arg_names.ptr()) == 0)
-                    {
-                        // no argument preprocessing
-                    }
-                    else if (n_actual > max_arity)
-                    {
-                        // too many arguments
-                        inner_args = handle<>();
-                    }
-                    else
-                    {
-                        // build a new arg tuple, will adjust its size later
-                        assert(max_arity <= static_cast<std::size_t>(ssize_t_max));
-                        inner_args = handle<>(
-                            PyTuple_New(static_cast<ssize_t>(max_arity)));
-
-                        // Fill in the positional arguments
-                        for (std::size_t i = 0; i < n_unnamed_actual; ++i)
-                            PyTuple_SET_ITEM(inner_args.get(), i, incref(PyTuple_GET_ITEM(args, i)));
-
-                        // Grab remaining arguments by name from the keyword dictionary
-                        std::size_t n_actual_processed = n_unnamed_actual;
-                
-                        for (std::size_t arg_pos = n_unnamed_actual; arg_pos < max_arity ; ++arg_pos)
-                        {
-                            // Get the keyword[, value pair] corresponding
-                            PyObject* kv = PyTuple_GET_ITEM(f->m_arg_names.ptr(), arg_pos);
-
-                            // If there were any keyword arguments,
-                            // look up the one we need for this
-                            // argument position
-                            PyObject* value = n_keyword_actual
-                                ? PyDict_GetItem(keywords, PyTuple_GET_ITEM(kv, 0))
-                                : 0;
-
-                            if (!value)
-                            {
-                                // Not found; check if there's a default value
-                                if (PyTuple_GET_SIZE(kv) > 1)
-                                    value = PyTuple_GET_ITEM(kv, 1);
-                        
-                                if (!value)
-                                {
-                                    // still not found; matching fails
-                                    PyErr_Clear();
-                                    inner_args = handle<>();
-                                    break;
-                                }
-                            }
-                            else
-                            {
-                                ++n_actual_processed;
-                            }
-
-                            PyTuple_SET_ITEM(inner_args.get(), arg_pos, incref(value));
-                        }
-
-                        if (inner_args.get())
-                        {
-                            //check if we proccessed all the arguments
-                            if(n_actual_processed < n_actual)
-                                inner_args = handle<>();
-                        }
-                    }
-                }
-            }
+            PyObject* result = 0;
             
-            // Call the function.  Pass keywords in case it's a
-            // function accepting any number of keywords
-            PyObject* result = inner_args ? f->m_fn(inner_args.get(), keywords) : 0;
+            if (n_keyword_actual == 0 && n_actual >= min_arity)
+            {
+                // The args can be passed along as they are. Pass
+                // keywords in case it's a function accepting any
+                // number of keywords
+                result = f->m_fn(args, keywords);
+                if (result != 0)
+                    cache_overload(argv, n_actual, f);
+            }
+            // Otherwise keyword arguments were supplied or default
+            // keyword values are needed
+            else if (f->m_arg_names.is_none())
+            {
+                // this overload doesn't accept keywords
+            }
+            else if (PyTuple_Size(f->m_arg_names.ptr()) == 0)
+            {
+                // "all keywords are none" is a special case
+                // indicating we will accept any number of keyword
+                // arguments; no argument preprocessing
+                result = f->m_fn(args, keywords);
+            }
+            else
+            {
+                // Arrange the arguments by position, to be passed
+                // along in place of a tuple
+                argument_array inner_args(max_arity);
+                if (f->bind_arguments(argv, n_unnamed_actual, 0, keywords, inner_args.get()))
+                    result = f->m_fn(inner_args.get(), max_arity);
+            }
             
             // If the result is NULL but no error was set, m_fn failed
             // the argument-matching test.
@@ -242,6 +279,252 @@ PyObject* function::call(PyObject* args, PyObject* keywords) const
     return 0;
 }
 
+PyObject* function::call(PyObject* const* argv, std::size_t nargs, PyObject* kwnames) const
+{
+    if (kwnames && PyTuple_GET_SIZE(kwnames) > 0)
+        return call_with_keywords(argv, nargs, kwnames);
+    
+    // Try the overload which last accepted these argument types
+    if (function const* cached = find_cached_overload(argv, nargs))
+    {
+        PyObject* result = cached->m_fn(argv, static_cast<unsigned>(nargs));
+        if (result != 0 || PyErr_Occurred())
+            return result;
+    }
+    
+    function const* f = this;
+
+    // Try overloads looking for a match
+    do
+    {
+        unsigned min_arity = f->m_fn.min_arity();
+        unsigned max_arity = f->m_fn.max_arity();
+
+        if (nargs <= max_arity)
+        {
+            PyObject* result = 0;
+            
+            if (nargs >= min_arity)
+            {
+                // The arguments can be passed along as they are
+                result = f->m_fn(argv, static_cast<unsigned>(nargs));
+                if (result != 0)
+                    cache_overload(argv, nargs, f);
+            }
+            else if (nargs + f->m_nkeyword_values >= min_arity)
+            {
+                // Default keyword values are needed
+                result = f->call_with_keywords(argv, nargs, 0);
+            }
+            
+            // See function::call(PyObject*, PyObject*) above
+            if (result != 0 || PyErr_Occurred())
+                return result;
+        }
+        f = f->m_overloads.get();
+    }
+    while (f);
+    
+    // None of the overloads matched; time to generate the error message
+    argument_error(argument_tuple(argv, nargs).get(), 0);
+    return 0;
+}
+
+// Handles the case of function::call(PyObject* const*, ...) where
+// keyword arguments are supplied or default values are needed. When
+// called with null kwnames, only this overload is tried.
+PyObject* function::call_with_keywords(
+    PyObject* const* argv, std::size_t nargs, PyObject* kwnames) const
+{
+    std::size_t n_keyword_actual = kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+    std::size_t n_actual = nargs + n_keyword_actual;
+    
+    function const* f = this;
+
+    // Try overloads looking for a match
+    do
+    {
+        // Check for a plausible number of arguments
+        unsigned min_arity = f->m_fn.min_arity();
+        unsigned max_arity = f->m_fn.max_arity();
+
+        PyObject* result = 0;
+        
+        if (n_actual + f->m_nkeyword_values >= min_arity
+            && n_actual <= max_arity
+            // this overload doesn't accept keywords
+            && !f->m_arg_names.is_none())
+        {
+            if (PyTuple_Size(f->m_arg_names.ptr()) == 0)
+            {
+                // "all keywords are none": a raw function accepting
+                // any number of keyword arguments, which expects to
+                // see them in a dict
+                handle<> keywords(PyDict_New());
+                for (std::size_t k = 0; k < n_keyword_actual; ++k)
+                {
+                    if (PyDict_SetItem(
+                            keywords.get(), PyTuple_GET_ITEM(kwnames, k), argv[nargs + k]) < 0)
+                        throw_error_already_set();
+                }
+                result = f->m_fn(argument_tuple(argv, nargs).get(), keywords.get());
+            }
+            else
+            {
+                // Arrange the arguments by position, to be passed
+                // along in place of a tuple
+                argument_array inner_args(max_arity);
+                if (f->bind_arguments(argv, nargs, kwnames, 0, inner_args.get()))
+                    result = f->m_fn(inner_args.get(), max_arity);
+            }
+        }
+        
+        // See function::call(PyObject*, PyObject*) above
+        if (result != 0 || PyErr_Occurred())
+            return result;
+
+        // Only one overload is tried when filling in default values
+        // for a positional call
+        if (!kwnames)
+            return 0;
+        
+        f = f->m_overloads.get();
+    }
+    while (f);
+    
+    // None of the overloads matched; time to generate the error message
+    argument_error(argument_tuple(argv, nargs).get(), 0);
+    return 0;
+}
+
+// Arranges the positional arguments argv[0..nargs) and the keyword
+// arguments, named either by the vectorcall kwnames or by the keys of
+// kwdict, in inner_args[0..max_arity) by position, filling in default
+// values where needed. Returns false iff the arguments don't match
+// this overload's keywords.
+bool function::bind_arguments(
+    PyObject* const* argv, std::size_t nargs
+  , PyObject* kwnames, PyObject* kwdict
+  , PyObject** inner_args) const
+{
+    std::size_t max_arity = m_keywords.size();
+    
+    std::copy(argv, argv + nargs, inner_args);
+    std::fill(inner_args + nargs, inner_args + max_arity, static_cast<PyObject*>(0));
+
+    if (kwnames)
+    {
+        std::size_t n_keyword_actual = PyTuple_GET_SIZE(kwnames);
+        for (std::size_t k = 0; k < n_keyword_actual; ++k)
+        {
+            if (!bind_keyword(PyTuple_GET_ITEM(kwnames, k), argv[nargs + k], nargs, inner_args))
+                return false;
+        }
+    }
+    else if (kwdict)
+    {
+        ssize_t pos = 0;
+        PyObject* name;
+        PyObject* value;
+        while (PyDict_Next(kwdict, &pos, &name, &value))
+        {
+            if (!bind_keyword(name, value, nargs, inner_args))
+                return false;
+        }
+    }
+    
+    for (std::size_t arg_pos = nargs; arg_pos < max_arity; ++arg_pos)
+    {
+        if (!inner_args[arg_pos])
+        {
+            // Not supplied; check if there's a default value
+            inner_args[arg_pos] = m_keywords[arg_pos].default_value;
+            if (!inner_args[arg_pos])
+                return false;
+        }
+    }
+    return true;
+}
+
+bool function::bind_keyword(
+    PyObject* name, PyObject* value, std::size_t nargs, PyObject** inner_args) const
+{
+    std::size_t const n = m_keywords.size();
+    std::size_t arg_pos = 0;
+
+    // Keyword names are interned, and so are the names the
+    // interpreter passes for keyword arguments in the usual case
+    while (arg_pos < n && m_keywords[arg_pos].name != name)
+        ++arg_pos;
+    
+    if (arg_pos == n)
+    {
+        for (arg_pos = 0; arg_pos < n; ++arg_pos)
+        {
+            if (m_keywords[arg_pos].name == 0)
+                continue;
+            
+            int equal = PyObject_RichCompareBool(m_keywords[arg_pos].name, name, Py_EQ);
+            if (equal < 0)
+                throw_error_already_set();
+            if (equal)
+                break;
+        }
+    }
+
+    // Fail on unknown keywords, and on arguments which were already
+    // supplied
+    if (arg_pos == n || arg_pos < nargs || inner_args[arg_pos])
+        return false;
+    
+    inner_args[arg_pos] = value;
+    return true;
+}
+
+function const* function::find_cached_overload(
+    PyObject* const* argv, std::size_t nargs) const
+{
+    if (!m_overloads || nargs > overload_cache_max_arity)
+        return 0;
+    
+    for (unsigned i = 0; i < overload_cache_size; ++i)
+    {
+        overload_cache_entry const& entry = m_overload_cache[i];
+        if (entry.overload == 0 || entry.nargs != nargs)
+            continue;
+
+        std::size_t n = 0;
+        while (n < nargs && entry.types[n].get() == Py_TYPE(argv[n]))
+            ++n;
+
+        if (n == nargs)
+            return entry.overload;
+    }
+    return 0;
+}
+
+void function::cache_overload(
+    PyObject* const* argv, std::size_t nargs, function const* f) const
+{
+    // There's nothing to skip unless there are several overloads
+    if (!m_overloads || nargs > overload_cache_max_arity)
+        return;
+    
+    overload_cache_entry& entry
+        = m_overload_cache[m_overload_cache_next++ % overload_cache_size];
+    
+    entry.overload = f;
+    entry.nargs = nargs;
+    for (std::size_t n = 0; n < nargs; ++n)
+        entry.types[n] = handle<PyTypeObject>(borrowed(Py_TYPE(argv[n])));
+}
+
+void function::clear_overload_cache()
+{
+    for (unsigned i = 0; i < overload_cache_size; ++i)
+        m_overload_cache[i] = overload_cache_entry();
+}
+
 object function::signature(bool show_return_type) const
 {
     py_function const& impl = m_fn;
@@ -327,6 +610,7 @@ void function::add_overload(handle<function> const& overload_)
         parent = parent->m_overloads.get();
 
     parent->m_overloads = overload_;
+    clear_overload_cache();
 
     // If we have no documentation, get the docs from the overload
     if (!m_doc)
@@ -591,6 +875,33 @@ namespace
       PyObject* m_args;
       PyObject* m_keywords;
   };
+
+#ifdef BOOST_PYTHON_HAS_VECTORCALL
+  struct bind_vectorcall_return
+  {
+      bind_vectorcall_return(
+          PyObject*& result, function const* f
+        , PyObject* const* argv, std::size_t nargs, PyObject* kwnames)
+          : m_result(result)
+            , m_f(f)
+            , m_argv(argv)
+            , m_nargs(nargs)
+            , m_kwnames(kwnames)
+      {}
+
+      void operator()() const
+      {
+          m_result = m_f->call(m_argv, m_nargs, m_kwnames);
+      }
+      
+   private:
+      PyObject*& m_result;
+      function const* m_f;
+      PyObject* const* m_argv;
+      std::size_t m_nargs;
+      PyObject* m_kwnames;
+  };
+#endif 
 }
 
 extern "C"
@@ -627,6 +938,19 @@ extern "C"
         return result;
     }
 
+#ifdef BOOST_PYTHON_HAS_VECTORCALL
+    static PyObject *
+    function_vectorcall(PyObject *func, PyObject* const* argv, size_t nargsf, PyObject *kwnames)
+    {
+        PyObject* result = 0;
+        handle_exception(
+            bind_vectorcall_return(
+                result, static_cast<function*>(func)
+              , argv, PyVectorcall_NARGS(nargsf), kwnames));
+        return result;
+    }
+#endif 
+
     //
     // Here we're using the function's tp_getset rather than its
     // tp_members to set up __doc__ and __name__, because tp_members
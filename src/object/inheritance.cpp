@@ -13,6 +13,7 @@
 #include <boost/property_map/property_map.hpp>
 #include <boost/bind.hpp>
 #include <boost/integer_traits.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
 #include <queue>
@@ -347,39 +348,112 @@ namespace
       return 0;
   }
 
+  //
+  // The results of searches, keyed on the interned ids of the types
+  // involved and the offset of the source object within its most
+  // derived object. Adding a cast to the graph can make unreachable
+  // targets reachable, so negative results remember the generation
+  // of the graph they were computed for, and go stale when it changes.
+  //
   struct cache_element
   {
-      typedef tuples::tuple<
-          class_id              // source static type
-          , class_id            // target type
-          , std::ptrdiff_t      // offset within source object
-          , class_id            // source dynamic type
-          >::inherited key_type;
-
-      cache_element(key_type const& k)
-          : key(k)
-          , offset(0)
-      {}
+      std::size_t src_t;            // source static type; 0 if unused
+      std::size_t dst_t;            // target type
+      std::ptrdiff_t src_offset;    // offset within source object
+      std::size_t dynamic_t;        // source dynamic type
       
-      key_type key;
-      std::ptrdiff_t offset;
+      std::ptrdiff_t offset;        // result, or not_found
+      std::size_t generation;       // graph generation, if not_found
 
       BOOST_STATIC_CONSTANT(
           std::ptrdiff_t, not_found = integer_traits<std::ptrdiff_t>::const_min);
+  };
+
+  // Incremented whenever a cast is added to the graph
+  std::size_t& cast_generation()
+  {
+      static std::size_t x = 0;
+      return x;
+  }
+
+  // An open-addressing hash table of cache_elements. Entries are
+  // never removed; stale ones are overwritten in place.
+  class cache_t : boost::noncopyable
+  {
+   public:
+      cache_t() : m_size(0) {}
+
+      // Returns the entry for the given key, or 0 if there is none
+      cache_element* find(
+          std::size_t src_t, std::size_t dst_t, std::ptrdiff_t src_offset, std::size_t dynamic_t)
+      {
+          if (m_slots.empty())
+              return 0;
+          cache_element& e = m_slots[probe(src_t, dst_t, src_offset, dynamic_t)];
+          return e.src_t == 0 ? 0 : &e;
+      }
+
+      // Precondition: find() returns 0 for the given key
+      cache_element& insert(
+          std::size_t src_t, std::size_t dst_t, std::ptrdiff_t src_offset, std::size_t dynamic_t)
+      {
+          // Keep the load factor at or below 1/2
+          if (2 * (m_size + 1) > m_slots.size())
+              grow();
+          
+          cache_element& e = m_slots[probe(src_t, dst_t, src_offset, dynamic_t)];
+          e.src_t = src_t;
+          e.dst_t = dst_t;
+          e.src_offset = src_offset;
+          e.dynamic_t = dynamic_t;
+          ++m_size;
+          return e;
+      }
       
-      bool operator<(cache_element const& rhs) const
+   private:
+      static std::size_t hash(
+          std::size_t src_t, std::size_t dst_t, std::ptrdiff_t src_offset, std::size_t dynamic_t)
       {
-          return this->key < rhs.key;
+          std::size_t h = src_t;
+          h = h * 31 + dst_t;
+          h = h * 31 + dynamic_t;
+          h = h * 31 + static_cast<std::size_t>(src_offset);
+          h *= 2654435761u;
+          return h ^ (h >> 16);
+      }
+      
+      std::size_t probe(
+          std::size_t src_t, std::size_t dst_t, std::ptrdiff_t src_offset, std::size_t dynamic_t) const
+      {
+          std::size_t mask = m_slots.size() - 1;
+          for (std::size_t i = hash(src_t, dst_t, src_offset, dynamic_t) & mask;; i = (i + 1) & mask)
+          {
+              cache_element const& e = m_slots[i];
+              if (e.src_t == 0
+                  || (e.src_t == src_t && e.dst_t == dst_t
+                      && e.src_offset == src_offset && e.dynamic_t == dynamic_t))
+              {
+                  return i;
+              }
+          }
       }
 
-      bool unreachable() const
+      void grow()
       {
-          return offset == not_found;
+          cache_element empty = { 0, 0, 0, 0, 0, 0 };
+          std::vector<cache_element> old(m_slots.empty() ? 64 : 2 * m_slots.size(), empty);
+          old.swap(m_slots);
+          
+          for (std::vector<cache_element>::const_iterator p = old.begin(); p != old.end(); ++p)
+          {
+              if (p->src_t != 0)
+                  m_slots[probe(p->src_t, p->dst_t, p->src_offset, p->dynamic_t)] = *p;
+          }
       }
+      
+      std::vector<cache_element> m_slots;    // size is zero or a power of 2
+      std::size_t m_size;
   };
-  
-  enum { kdst_t = ksrc_static_t + 1, koffset, ksrc_dynamic_t };
-  typedef std::vector<cache_element> cache_t;
 
   cache_t& cache()
   {
@@ -407,17 +481,20 @@ namespace
       // Look in the cache first for a quickie address translation
       std::ptrdiff_t offset = (char*)p - (char*)dynamic_id.first;
 
-      cache_element seek(boost::make_tuple(src_t, dst_t, offset, dynamic_id.second));
+      std::size_t const src_id = src_t.hash();
+      std::size_t const dst_id = dst_t.hash();
+      std::size_t const dynamic_type_id = dynamic_id.second.hash();
+      
       cache_t& c = cache();
-      cache_t::iterator const cache_pos
-          = std::lower_bound(c.begin(), c.end(), seek);
-                      
+      cache_element* cached = c.find(src_id, dst_id, offset, dynamic_type_id);
 
-      // if found in the cache, we're done
-      if (cache_pos != c.end() && cache_pos->key == seek.key)
+      // if found in the cache, and not outdated, we're done
+      if (cached != 0)
       {
-          return cache_pos->offset == cache_element::not_found
-              ? 0 : (char*)p + cache_pos->offset;
+          if (cached->offset != cache_element::not_found)
+              return (char*)p + cached->offset;
+          if (cached->generation == cast_generation())
+              return 0;
       }
 
       // If we are starting at the most-derived type, only look in the up graph
@@ -429,43 +506,129 @@ namespace
           , tuples::get<kvertex>(*dst_p));
 
       // update the cache
-      c.insert(cache_pos, seek)->offset
-          = (result == 0) ? cache_element::not_found : (char*)result - (char*)p;
+      if (cached == 0)
+          cached = &c.insert(src_id, dst_id, offset, dynamic_type_id);
+      
+      cached->offset = (result == 0) ? cache_element::not_found : (char*)result - (char*)p;
+      cached->generation = cast_generation();
 
       return result;
   }
 }
 
+namespace
+{
+  //
+  // Upcasts to non-virtual bases, which are just a constant pointer
+  // adjustment, are kept in a table indexed by the interned id of the
+  // source type (see type_info::hash()). Each entry lists all of the
+  // type's registered bases, direct or not, with their offsets.
+  //
+  struct upcast_entry
+  {
+      std::size_t dst;
+      std::ptrdiff_t offset;
+  };
+  
+  typedef std::vector<upcast_entry> upcasts_t;
+
+  // A base which can be reached at more than one offset is ambiguous,
+  // and left to the cast graph search.
+  std::ptrdiff_t const ambiguous_offset = cache_element::not_found;
+
+  std::vector<upcasts_t>& upcast_table()
+  {
+      static std::vector<upcasts_t> x;
+      return x;
+  }
+
+  void record_upcast(std::size_t src, std::size_t dst, std::ptrdiff_t offset)
+  {
+      std::vector<upcasts_t>& table = upcast_table();
+      if (src >= table.size())
+          table.resize(src + 1);
+
+      upcasts_t& upcasts = table[src];
+      for (upcasts_t::iterator p = upcasts.begin(); p != upcasts.end(); ++p)
+      {
+          if (p->dst == dst)
+          {
+              if (p->offset != offset)
+                  p->offset = ambiguous_offset;
+              return;
+          }
+      }
+      
+      upcast_entry e = { dst, offset };
+      upcasts.push_back(e);
+  }
+
+  inline void* static_upcast(void* p, class_id src_t, class_id dst_t)
+  {
+      std::vector<upcasts_t> const& table = upcast_table();
+      std::size_t src = src_t.hash();
+      if (src >= table.size())
+          return 0;
+
+      upcasts_t const& upcasts = table[src];
+      std::size_t dst = dst_t.hash();
+      for (upcasts_t::const_iterator q = upcasts.begin(); q != upcasts.end(); ++q)
+      {
+          if (q->dst == dst)
+          {
+              return q->offset == ambiguous_offset
+                  ? 0 : static_cast<char*>(p) + q->offset;
+          }
+      }
+      return 0;
+  }
+}
+
 namespace python { namespace objects {
 
 BOOST_PYTHON_DECL void* find_dynamic_type(void* p, class_id src_t, class_id dst_t)
 {
+    if (void* result = static_upcast(p, src_t, dst_t))
+        return result;
     return convert_type(p, src_t, dst_t, true);
 }
 
 BOOST_PYTHON_DECL void* find_static_type(void* p, class_id src_t, class_id dst_t)
 {
+    if (void* result = static_upcast(p, src_t, dst_t))
+        return result;
     return convert_type(p, src_t, dst_t, false);
 }
 
+BOOST_PYTHON_DECL void add_upcast_offset(
+    class_id src_t, class_id dst_t, std::ptrdiff_t offset)
+{
+    std::size_t src = src_t.hash();
+    std::size_t dst = dst_t.hash();
+    record_upcast(src, dst, offset);
+
+    // Base classes are registered before the classes derived from
+    // them, so the bases of dst are already known and are bases of
+    // src too. Copy them, since record_upcast() may grow the table.
+    std::vector<upcasts_t> const& table = upcast_table();
+    if (dst < table.size())
+    {
+        upcasts_t const bases = table[dst];
+        for (upcasts_t::const_iterator p = bases.begin(); p != bases.end(); ++p)
+        {
+            record_upcast(
+                src, p->dst
+              , p->offset == ambiguous_offset ? ambiguous_offset : offset + p->offset);
+        }
+    }
+}
+
 BOOST_PYTHON_DECL void add_cast(
     class_id src_t, class_id dst_t, cast_function cast, bool is_downcast)
 {
     // adding an edge will invalidate any record of unreachability in
     // the cache.
-    static std::size_t expected_cache_len = 0;
-    cache_t& c = cache();
-    if (c.size() > expected_cache_len)
-    {
-        c.erase(std::remove_if(
-                    c.begin(), c.end(),
-                    mem_fn(&cache_element::unreachable))
-                , c.end());
-
-        // If any new cache entries get added, we'll have to do this
-        // again when the next edge is added
-        expected_cache_len = c.size();
-    }
+    ++cast_generation();
     
     type_index_iterator_pair types = demand_types(src_t, dst_t);
     vertex_t src = tuples::get<kvertex>(*types.first);
@@ -5,6 +5,8 @@
 
 #include <boost/python/object/iterator_core.hpp>
 #include <boost/python/object/function_object.hpp>
+#include <boost/python/object.hpp>
+#include <boost/python/cast.hpp>
 #include <boost/bind.hpp>
 #include <boost/mpl/vector/vector10.hpp>
 
@@ -36,4 +38,23 @@ void stop_iteration_error()
     throw_error_already_set();
 }
 
+BOOST_PYTHON_DECL void set_iterator_slots(
+    object const& iterator_class, PyObject* (*next)(PyObject*))
+{
+    // Assigning __iter__ or __next__ afterwards resets the slots from
+    // the class dictionary, as it should.
+    PyTypeObject* type = downcast<PyTypeObject>(iterator_class.ptr());
+    type->tp_iter = &PyObject_SelfIter;
+    type->tp_iternext = next;
+    PyType_Modified(type);
+}
+
+BOOST_PYTHON_DECL PyObject* iterator_range_unbound(PyObject* self)
+{
+    PyErr_Format(
+        PyExc_TypeError, "'%.100s' object holds no iterator range"
+      , Py_TYPE(self)->tp_name);
+    return 0;
+}
+
 }}} // namespace boost::python::objects
@@ -77,6 +77,44 @@ BOOST_PYTHON_DECL void delattr(object const& target, char const* key)
     }
 }
 
+PyObject* attribute_name::intern() const
+{
+#if PY_VERSION_HEX >= 0x03000000
+    m_object = expect_non_null(PyUnicode_InternFromString(m_name));
+#else
+    m_object = expect_non_null(PyString_InternFromString(m_name));
+#endif
+    return m_object;
+}
+
+BOOST_PYTHON_DECL object getattr(object const& target, attribute_name const& key)
+{
+    return object(detail::new_reference(PyObject_GetAttr(target.ptr(), key.get())));
+}
+
+BOOST_PYTHON_DECL object getattr(object const& target, attribute_name const& key, object const& default_)
+{
+    PyObject* result = PyObject_GetAttr(target.ptr(), key.get());
+    if (result == NULL && PyErr_ExceptionMatches(PyExc_AttributeError))
+    {
+        PyErr_Clear();
+        return default_;
+    }
+    return object(detail::new_reference(result));
+}
+
+BOOST_PYTHON_DECL void setattr(object const& target, attribute_name const& key, object const& value)
+{
+    if (PyObject_SetAttr(target.ptr(), key.get(), value.ptr()) == -1)
+        throw_error_already_set();
+}
+
+BOOST_PYTHON_DECL void delattr(object const& target, attribute_name const& key)
+{
+    if (PyObject_DelAttr(target.ptr(), key.get()) == -1)
+        throw_error_already_set();
+}
+
 BOOST_PYTHON_DECL object getitem(object const& target, object const& key)
 {
     return object(detail::new_reference(
@@ -50,6 +50,86 @@ namespace {
       return static_cast<ssize_t>(n);
     }
 
+#if PY_VERSION_HEX >= 0x03000000
+    // The PyUnicode API stands in for the methods of exact str
+    // objects only, since subclasses may override them.
+    inline bool is_exact_str(object const& x)
+    {
+      return PyUnicode_CheckExact(x.ptr());
+    }
+
+    inline bool is_str(object const& x)
+    {
+      return PyUnicode_Check(x.ptr());
+    }
+
+    // Gets the value of an int slice index. Returns false for other
+    // types, or if the value doesn't fit, leaving those to the
+    // method itself.
+    bool get_index(object const& x, ssize_t& result)
+    {
+      if (!PyLong_CheckExact(x.ptr()))
+          return false;
+      result = PyLong_AsSsize_t(x.ptr());
+      if (result == -1 && PyErr_Occurred())
+      {
+          PyErr_Clear();
+          return false;
+      }
+      return true;
+    }
+
+    long find(object const& self, object const& sub, ssize_t start, ssize_t end, int direction)
+    {
+      ssize_t result = PyUnicode_Find(self.ptr(), sub.ptr(), start, end, direction);
+      if (result == -2)
+          throw_error_already_set();
+      return result;
+    }
+
+    long index(object const& self, object const& sub, ssize_t start, ssize_t end, int direction)
+    {
+      long result = find(self, sub, start, end, direction);
+      if (result == -1)
+      {
+          PyErr_SetString(PyExc_ValueError, "substring not found");
+          throw_error_already_set();
+      }
+      return result;
+    }
+
+    long count(object const& self, object const& sub, ssize_t start, ssize_t end)
+    {
+      ssize_t result = PyUnicode_Count(self.ptr(), sub.ptr(), start, end);
+      if (result == -1)
+          throw_error_already_set();
+      return result;
+    }
+
+    bool tailmatch(object const& self, object const& sub, ssize_t start, ssize_t end, int direction)
+    {
+      ssize_t result = PyUnicode_Tailmatch(self.ptr(), sub.ptr(), start, end, direction);
+      if (result == -1)
+          throw_error_already_set();
+      return result != 0;
+    }
+
+    list split(object const& self, PyObject* sep, ssize_t maxsplit)
+    {
+      return list(new_reference(expect_non_null(
+          PyUnicode_Split(self.ptr(), sep == Py_None ? 0 : sep, maxsplit))));
+    }
+#endif
+
+    // Calls the named method, interning the name on first use.
+#if PY_VERSION_HEX >= 0x03000000
+# define BOOST_PYTHON_STR_METHOD_NAME(name) \
+    static PyObject* const name_ = ::PyUnicode_InternFromString(#name)
+#else
+# define BOOST_PYTHON_STR_METHOD_NAME(name) \
+    static PyObject* const name_ = ::PyString_InternFromString(#name)
+#endif
+
 } // namespace <anonymous>
 
 str_base::str_base(char const* start, char const* finish)
@@ -82,19 +162,18 @@ str_base::str_base(object_cref other)
     : object(str_base::call(other))
 {}
 
-#define BOOST_PYTHON_FORMAT_OBJECT(z, n, data) "O"
 #define BOOST_PYTHON_OBJECT_PTR(z, n, data) , x##n .ptr()
 
 #define BOOST_PYTHON_DEFINE_STR_METHOD(name, arity)                             \
 str str_base:: name ( BOOST_PP_ENUM_PARAMS(arity, object_cref x) ) const        \
 {                                                                               \
+    BOOST_PYTHON_STR_METHOD_NAME(name);                                         \
     return str(new_reference(                                                   \
        expect_non_null(                                                         \
-           PyObject_CallMethod(                                                 \
-               this->ptr(), const_cast<char*>( #name ),                         \
-               const_cast<char*>(                                               \
-                 "(" BOOST_PP_REPEAT(arity, BOOST_PYTHON_FORMAT_OBJECT, _) ")") \
-               BOOST_PP_REPEAT_1(arity, BOOST_PYTHON_OBJECT_PTR, _)))));        \
+           PyObject_CallMethodObjArgs(                                          \
+               this->ptr(), expect_non_null(name_)                              \
+               BOOST_PP_REPEAT_1(arity, BOOST_PYTHON_OBJECT_PTR, _)             \
+             , static_cast<PyObject*>(0)))));                                   \
 }
 
 BOOST_PYTHON_DEFINE_STR_METHOD(capitalize, 0)
@@ -102,16 +181,30 @@ BOOST_PYTHON_DEFINE_STR_METHOD(center, 1)
 
 long str_base::count(object_cref sub) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(sub))
+        return detail::count(*this, sub, 0, ssize_t_max);
+#endif
     return extract<long>(this->attr("count")(sub));
 }
 
 long str_base::count(object_cref sub, object_cref start) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_))
+        return detail::count(*this, sub, start_, ssize_t_max);
+#endif
     return extract<long>(this->attr("count")(sub,start));
 }
 
 long str_base::count(object_cref sub, object_cref start, object_cref end) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_) && get_index(end, end_))
+        return detail::count(*this, sub, start_, end_);
+#endif
     return extract<long>(this->attr("count")(sub,start,end));
 }
 
@@ -156,17 +249,51 @@ object str_base::encode(object_cref encoding, object_cref errors) const
 
 bool str_base::endswith(object_cref suffix) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(suffix))
+        return tailmatch(*this, suffix, 0, ssize_t_max, 1);
+#endif
     bool result = _BOOST_PYTHON_ASLONG(this->attr("endswith")(suffix).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
     return result;
 }
 
+bool str_base::endswith(object_cref suffix, object_cref start) const
+{
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(suffix) && get_index(start, start_))
+        return tailmatch(*this, suffix, start_, ssize_t_max, 1);
+#endif
+    bool result = _BOOST_PYTHON_ASLONG(this->attr("endswith")(suffix,start).ptr());
+    if (PyErr_Occurred())
+        throw_error_already_set();
+    return result;
+}
+
+bool str_base::endswith(object_cref suffix, object_cref start, object_cref end) const
+{
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(suffix) && get_index(start, start_) && get_index(end, end_))
+        return tailmatch(*this, suffix, start_, end_, 1);
+#endif
+    bool result = _BOOST_PYTHON_ASLONG(this->attr("endswith")(suffix,start,end).ptr());
+    if (PyErr_Occurred())
+        throw_error_already_set();
+    return result;
+}
+
 BOOST_PYTHON_DEFINE_STR_METHOD(expandtabs, 0)
 BOOST_PYTHON_DEFINE_STR_METHOD(expandtabs, 1)
 
 long str_base::find(object_cref sub) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(sub))
+        return detail::find(*this, sub, 0, ssize_t_max, 1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("find")(sub).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -175,6 +302,11 @@ long str_base::find(object_cref sub) const
 
 long str_base::find(object_cref sub, object_cref start) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_))
+        return detail::find(*this, sub, start_, ssize_t_max, 1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("find")(sub,start).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -183,6 +315,11 @@ long str_base::find(object_cref sub, object_cref start) const
 
 long str_base::find(object_cref sub, object_cref start, object_cref end) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_) && get_index(end, end_))
+        return detail::find(*this, sub, start_, end_, 1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("find")(sub,start,end).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -191,6 +328,10 @@ long str_base::find(object_cref sub, object_cref start, object_cref end) const
 
 long str_base::index(object_cref sub) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(sub))
+        return detail::index(*this, sub, 0, ssize_t_max, 1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("index")(sub).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -199,6 +340,11 @@ long str_base::index(object_cref sub) const
 
 long str_base::index(object_cref sub, object_cref start) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_))
+        return detail::index(*this, sub, start_, ssize_t_max, 1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("index")(sub,start).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -207,6 +353,11 @@ long str_base::index(object_cref sub, object_cref start) const
 
 long str_base::index(object_cref sub, object_cref start, object_cref end) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_) && get_index(end, end_))
+        return detail::index(*this, sub, start_, end_, 1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("index")(sub,start,end).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -269,15 +420,64 @@ bool str_base::isupper() const
     return result;
 }
 
-BOOST_PYTHON_DEFINE_STR_METHOD(join, 1)
+str str_base::join(object_cref sequence) const
+{
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this))
+    {
+        return str(new_reference(
+            expect_non_null(PyUnicode_Join(this->ptr(), sequence.ptr()))));
+    }
+#endif
+    BOOST_PYTHON_STR_METHOD_NAME(join);
+    return str(new_reference(expect_non_null(
+        PyObject_CallMethodObjArgs(
+            this->ptr(), expect_non_null(name_), sequence.ptr(), static_cast<PyObject*>(0)))));
+}
+
 BOOST_PYTHON_DEFINE_STR_METHOD(ljust, 1)
 BOOST_PYTHON_DEFINE_STR_METHOD(lower, 0)
 BOOST_PYTHON_DEFINE_STR_METHOD(lstrip, 0)
-BOOST_PYTHON_DEFINE_STR_METHOD(replace, 2)
-BOOST_PYTHON_DEFINE_STR_METHOD(replace, 3)
+
+str str_base::replace(object_cref old, object_cref new_) const
+{
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(old) && is_str(new_))
+    {
+        return str(new_reference(expect_non_null(
+            PyUnicode_Replace(this->ptr(), old.ptr(), new_.ptr(), -1))));
+    }
+#endif
+    BOOST_PYTHON_STR_METHOD_NAME(replace);
+    return str(new_reference(expect_non_null(
+        PyObject_CallMethodObjArgs(
+            this->ptr(), expect_non_null(name_), old.ptr(), new_.ptr()
+          , static_cast<PyObject*>(0)))));
+}
+
+str str_base::replace(object_cref old, object_cref new_, object_cref maxsplit) const
+{
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t maxsplit_;
+    if (is_exact_str(*this) && is_str(old) && is_str(new_) && get_index(maxsplit, maxsplit_))
+    {
+        return str(new_reference(expect_non_null(
+            PyUnicode_Replace(this->ptr(), old.ptr(), new_.ptr(), maxsplit_))));
+    }
+#endif
+    BOOST_PYTHON_STR_METHOD_NAME(replace);
+    return str(new_reference(expect_non_null(
+        PyObject_CallMethodObjArgs(
+            this->ptr(), expect_non_null(name_), old.ptr(), new_.ptr(), maxsplit.ptr()
+          , static_cast<PyObject*>(0)))));
+}
 
 long str_base::rfind(object_cref sub) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(sub))
+        return detail::find(*this, sub, 0, ssize_t_max, -1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("rfind")(sub).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -286,6 +486,11 @@ long str_base::rfind(object_cref sub) const
 
 long str_base::rfind(object_cref sub, object_cref start) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_))
+        return detail::find(*this, sub, start_, ssize_t_max, -1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("rfind")(sub,start).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -294,6 +499,11 @@ long str_base::rfind(object_cref sub, object_cref start) const
 
 long str_base::rfind(object_cref sub, object_cref start, object_cref end) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_) && get_index(end, end_))
+        return detail::find(*this, sub, start_, end_, -1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("rfind")(sub,start,end).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -302,6 +512,10 @@ long str_base::rfind(object_cref sub, object_cref start, object_cref end) const
 
 long str_base::rindex(object_cref sub) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(sub))
+        return detail::index(*this, sub, 0, ssize_t_max, -1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("rindex")(sub).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -310,6 +524,11 @@ long str_base::rindex(object_cref sub) const
 
 long str_base::rindex(object_cref sub, object_cref start) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_))
+        return detail::index(*this, sub, start_, ssize_t_max, -1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("rindex")(sub,start).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -318,6 +537,11 @@ long str_base::rindex(object_cref sub, object_cref start) const
 
 long str_base::rindex(object_cref sub, object_cref start, object_cref end) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(sub) && get_index(start, start_) && get_index(end, end_))
+        return detail::index(*this, sub, start_, end_, -1);
+#endif
     long result = _BOOST_PYTHON_ASLONG(this->attr("rindex")(sub,start,end).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -329,31 +553,59 @@ BOOST_PYTHON_DEFINE_STR_METHOD(rstrip, 0)
 
 list str_base::split() const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this))
+        return detail::split(*this, 0, -1);
+#endif
     return list(this->attr("split")());
 }
 
 list str_base::split(object_cref sep) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && (is_str(sep) || sep.ptr() == Py_None))
+        return detail::split(*this, sep.ptr(), -1);
+#endif
     return list(this->attr("split")(sep));
 }
 
 list str_base::split(object_cref sep, object_cref maxsplit) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t maxsplit_;
+    if (is_exact_str(*this) && (is_str(sep) || sep.ptr() == Py_None) && get_index(maxsplit, maxsplit_))
+        return detail::split(*this, sep.ptr(), maxsplit_);
+#endif
     return list(this->attr("split")(sep,maxsplit));
 }
 
 list str_base::splitlines() const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this))
+        return list(new_reference(expect_non_null(PyUnicode_Splitlines(this->ptr(), 0))));
+#endif
     return list(this->attr("splitlines")());
 }
 
 list str_base::splitlines(object_cref keepends) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && PyBool_Check(keepends.ptr()))
+    {
+        return list(new_reference(expect_non_null(
+            PyUnicode_Splitlines(this->ptr(), keepends.ptr() == Py_True))));
+    }
+#endif
     return list(this->attr("splitlines")(keepends));
 }
 
 bool str_base::startswith(object_cref prefix) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    if (is_exact_str(*this) && is_str(prefix))
+        return tailmatch(*this, prefix, 0, ssize_t_max, -1);
+#endif
     bool result = _BOOST_PYTHON_ASLONG(this->attr("startswith")(prefix).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -362,6 +614,11 @@ bool str_base::startswith(object_cref prefix) const
 
 bool str_base::startswith(object_cref prefix, object_cref start) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_;
+    if (is_exact_str(*this) && is_str(prefix) && get_index(start, start_))
+        return tailmatch(*this, prefix, start_, ssize_t_max, -1);
+#endif
     bool result = _BOOST_PYTHON_ASLONG(this->attr("startswith")(prefix,start).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
@@ -370,6 +627,11 @@ bool str_base::startswith(object_cref prefix, object_cref start) const
 
 bool str_base::startswith(object_cref prefix, object_cref start, object_cref end) const
 {
+#if PY_VERSION_HEX >= 0x03000000
+    ssize_t start_, end_;
+    if (is_exact_str(*this) && is_str(prefix) && get_index(start, start_) && get_index(end, end_))
+        return tailmatch(*this, prefix, start_, end_, -1);
+#endif
     bool result = _BOOST_PYTHON_ASLONG(this->attr("startswith")(prefix,start,end).ptr());
     if (PyErr_Occurred())
         throw_error_already_set();
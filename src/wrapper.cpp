@@ -3,18 +3,115 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <boost/python/wrapper.hpp>
+#include <boost/python/converter/registrations.hpp>
+
+#include <string>
 
 namespace boost { namespace python {
 
 namespace detail
 {
+  namespace
+  {
+    // Remembers which virtual functions a Python class derived from
+    // a wrapped class doesn't override, so that calling one of them
+    // needn't look up the attribute and build a bound method. Entries
+    // are tied to the class's version tag, which Python invalidates
+    // whenever the class or one of its bases is modified.
+    struct override_cache_entry
+    {
+        override_cache_entry() : type(0), class_object(0), version_tag(0) {}
+
+        PyTypeObject* type;
+        PyTypeObject* class_object;
+        unsigned int version_tag;
+        std::string name;
+    };
+
+    std::size_t const override_cache_size = 256;
+    override_cache_entry override_cache[override_cache_size];
+
+    bool has_version_tag(PyTypeObject* type)
+    {
+#ifdef Py_TPFLAGS_VALID_VERSION_TAG
+        return PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG);
+#else
+        return false;
+#endif
+    }
+
+    override_cache_entry& find_override_cache_entry(
+        PyTypeObject* type, PyTypeObject* class_object, char const* name)
+    {
+        std::size_t h = reinterpret_cast<std::size_t>(type) >> 4;
+        h ^= reinterpret_cast<std::size_t>(class_object) >> 4;
+        for (char const* p = name; *p; ++p)
+            h = h * 31 + static_cast<unsigned char>(*p);
+        return override_cache[h % override_cache_size];
+    }
+
+    bool is_cached(
+        override_cache_entry const& e
+      , PyTypeObject* type, PyTypeObject* class_object, char const* name)
+    {
+        return e.type == type
+            && e.class_object == class_object
+            && has_version_tag(type)
+            && e.version_tag == type->tp_version_tag
+            && e.name == name;
+    }
+
+    // Returns true iff self's __dict__ may hold an attribute named
+    // name, which would override any method.
+    bool has_instance_attribute(PyObject* self, char const* name)
+    {
+        PyObject** dict = _PyObject_GetDictPtr(self);
+        if (dict == 0 || *dict == 0 || PyDict_Size(*dict) == 0)
+            return false;
+        return ::PyDict_GetItemString(*dict, const_cast<char*>(name)) != 0;
+    }
+  }
+
+  override wrapper_base::get_override(
+      char const* name
+    , PyTypeObject* class_object
+  ) const
+  {
+      return override(this->find_override(name, class_object));
+  }
+
   override wrapper_base::get_override(
       char const* name
+    , converter::registration const& r
+    , gil_mode mode
+  ) const
+  {
+      override result(mode);
+      static_cast<object&>(result) = object(
+          this->find_override(name, r.get_class_object()));
+      return result;
+  }
+
+  handle<> wrapper_base::find_override(
+      char const* name
     , PyTypeObject* class_object
   ) const
   {
       if (this->m_self)
       {
+          PyTypeObject* type = Py_TYPE(this->m_self);
+
+          // Classes which customize attribute lookup can't be cached.
+          bool cacheable = type->tp_getattro == PyObject_GenericGetAttr;
+          override_cache_entry& e = find_override_cache_entry(type, class_object, name);
+
+          if (cacheable
+              && is_cached(e, type, class_object, name)
+              && !has_instance_attribute(this->m_self, name))
+          {
+              return handle<>(detail::none());
+          }
+
           if (handle<> m = handle<>(
                   python::allow_null(
                       ::PyObject_GetAttrString(
@@ -35,10 +132,20 @@ namespace detail
 
               }
               if (borrowed_f != ((PyMethodObject*)m.get())->im_func)
-                  return override(m);
+                  return m;
+
+              // The attribute lookup above has given the class a
+              // version tag, if it can have one.
+              if (cacheable && borrowed_f != 0 && has_version_tag(type))
+              {
+                  e.type = type;
+                  e.class_object = class_object;
+                  e.version_tag = type->tp_version_tag;
+                  e.name = name;
+              }
           }
       }
-      return override(handle<>(detail::none()));
+      return handle<>(detail::none());
   }
 }
 
@@ -0,0 +1,52 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/module.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/buffer_view.hpp>
+#include <numeric>
+#include <vector>
+
+using namespace boost::python;
+
+double sum(buffer_view<double const> x)
+{
+    return std::accumulate(x.begin(), x.end(), 0.0);
+}
+
+void scale(buffer_view<double> x, double factor)
+{
+    for (buffer_view<double>::iterator p = x.begin(); p != x.end(); ++p)
+        *p *= factor;
+}
+
+double sum_vector(std::vector<double> const& x)
+{
+    return std::accumulate(x.begin(), x.end(), 0.0);
+}
+
+int byte_total(buffer_view<unsigned char const> x)
+{
+    return std::accumulate(x.begin(), x.end(), 0);
+}
+
+long long_total(buffer_view<long const> x)
+{
+    return std::accumulate(x.begin(), x.end(), 0L);
+}
+
+BOOST_PYTHON_MODULE(buffer_view_ext)
+{
+    register_buffer_from_python<double>();
+    register_buffer_from_python<unsigned char>();
+    register_buffer_from_python<long>();
+
+    def("sum", sum);
+    def("scale", scale);
+    def("sum_vector", sum_vector);
+    def("byte_total", byte_total);
+    def("long_total", long_total);
+}
+
+#include "module_tail.cpp"
@@ -0,0 +1,62 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+>>> from buffer_view_ext import *
+>>> from array import array
+
+>>> a = array('d', [1.5, 2.5, 3.0])
+>>> sum(a)
+7.0
+>>> sum(memoryview(a))
+7.0
+>>> sum_vector(a)
+7.0
+>>> scale(a, 2)
+>>> list(a)
+[3.0, 5.0, 6.0]
+
+>>> byte_total(bytearray([1, 2, 3]))
+6
+>>> long_total(array('l', [1, 2, 3]))
+6
+
+   The element type must match:
+
+>>> try: sum(array('f', [1.0]))
+... except TypeError: pass
+... else: print('expected a TypeError')
+
+>>> try: sum(array('i', [1]))
+... except TypeError: pass
+... else: print('expected a TypeError')
+
+   Writable views need writable buffers:
+
+>>> try: scale(memoryview(a).toreadonly(), 2)
+... except TypeError: pass
+... else: print('expected a TypeError')
+>>> sum(memoryview(a).toreadonly())
+14.0
+
+   Only contiguous buffers are accepted:
+
+>>> try: sum(memoryview(a)[::2])
+... except TypeError: pass
+... else: print('expected a TypeError')
+'''
+
+def run(args = None):
+    import sys
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print("running...")
+    import sys
+    status = run()[0]
+    if (status == 0): print("Done.")
+    sys.exit(status)
@@ -0,0 +1,52 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/python/module.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/cache_by_address.hpp>
+#include <boost/python/return_value_policy.hpp>
+
+using namespace boost::python;
+
+struct Node
+{
+    Node(int value) : value(value) {}
+    int value;
+};
+
+Node nodes[2] = { Node(1), Node(2) };
+
+Node* get_node(int i) { return i < 0 ? 0 : &nodes[i]; }
+Node& get_node_ref(int i) { return nodes[i]; }
+
+typedef struct resource_* resource;
+
+resource resources[2] = { (resource)0x1000, (resource)0x2000 };
+
+resource get_resource(int i) { return i < 0 ? 0 : resources[i]; }
+bool is_resource(resource r, int i) { return r == resources[i]; }
+
+BOOST_PYTHON_OPAQUE_SPECIALIZED_TYPE_ID(resource_)
+
+BOOST_PYTHON_MODULE(cache_by_address_ext)
+{
+    class_<Node>("Node", no_init)
+        .def_readwrite("value", &Node::value)
+        ;
+
+    def("get_node", get_node,
+        return_value_policy<cache_by_address<reference_existing_object> >());
+    def("get_node_ref", get_node_ref,
+        return_value_policy<cache_by_address<reference_existing_object> >());
+    def("get_node_uncached", get_node,
+        return_value_policy<reference_existing_object>());
+
+    def("get_resource", get_resource,
+        return_value_policy<cache_by_address<return_opaque_pointer> >());
+    def("get_resource_uncached", get_resource,
+        return_value_policy<return_opaque_pointer>());
+    def("is_resource", is_resource);
+}
+
+#include "module_tail.cpp"
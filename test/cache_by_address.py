@@ -0,0 +1,72 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+"""
+>>> from cache_by_address_ext import *
+
+    The same address yields the same wrapper while it's alive
+
+>>> n = get_node(0)
+>>> n.value
+1
+>>> get_node(0) is n
+True
+>>> get_node_ref(0) is n
+True
+>>> get_node(1) is n
+False
+>>> get_node(-1) is None
+True
+
+    Attributes set from Python survive
+
+>>> n.tag = 'first'
+>>> get_node(0).tag
+'first'
+
+    Uncached returns are unaffected
+
+>>> get_node_uncached(0) is n
+False
+
+    Once the wrapper is gone a new one is made
+
+>>> import weakref
+>>> r = weakref.ref(n)
+>>> del n
+>>> r() is None
+True
+>>> hasattr(get_node(0), 'tag')
+False
+
+    Opaque pointers
+
+>>> h = get_resource(0)
+>>> is_resource(h, 0)
+True
+>>> get_resource(0) is h
+True
+>>> get_resource(1) is h
+False
+>>> get_resource(-1) is None
+True
+>>> get_resource_uncached(0) is h
+False
+>>> del h
+>>> is_resource(get_resource(0), 0)
+True
+"""
+def run(args = None):
+    import sys
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print("running...")
+    import sys
+    status = run()[0]
+    if (status == 0): print("Done.")
+    sys.exit(status)
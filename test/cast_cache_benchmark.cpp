@@ -0,0 +1,130 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Builds several hierarchies of stacked virtual diamonds, so that
+// passing their objects to functions taking references to other
+// classes in them fills and exercises the cast cache. See
+// cast_cache_benchmark.py.
+//
+//              node<F,N-1>
+//             /           \       (virtual inheritance)
+//      left<F,N>       right<F,N>
+//             \           /
+//               node<F,N>
+//
+// The number of inheritance paths doubles with each level, and so
+// does the time taken to compile them, so the hierarchies are kept
+// fairly shallow and there are several of them instead.
+
+#include <boost/python/module.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/reference_existing_object.hpp>
+#include <boost/python/return_value_policy.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/range_c.hpp>
+#include <cstdio>
+
+using namespace boost::python;
+
+#define FAMILIES 10
+#define DEPTH 8
+
+template <int F, int N> struct node;
+
+template <int F>
+struct node<F,0>
+{
+    virtual ~node() {}
+};
+
+template <int F, int N> struct left : virtual node<F,N-1> {};
+template <int F, int N> struct right : virtual node<F,N-1> {};
+template <int F, int N> struct node : left<F,N>, right<F,N> {};
+
+// instances[f][n] is the most-derived object of type node<f,n>
+void* instances[FAMILIES][DEPTH + 1];
+
+template <int F>
+node<F,0>* get(int n)
+{
+    return static_cast<node<F,0>*>(instances[F][n]);
+}
+
+template <class T>
+bool take(T&)
+{
+    return true;
+}
+
+template <class T>
+void register_class(char const* kind, int f, int n)
+{
+    char name[32];
+    std::sprintf(name, "%s_%d_%d", kind, f, n);
+    class_<T>(name, no_init);
+    std::sprintf(name, "take_%s_%d_%d", kind, f, n);
+    def(name, take<T>);
+}
+
+template <class T, class Bases>
+void register_class(char const* kind, int f, int n, Bases)
+{
+    char name[32];
+    std::sprintf(name, "%s_%d_%d", kind, f, n);
+    class_<T, Bases>(name, no_init);
+    std::sprintf(name, "take_%s_%d_%d", kind, f, n);
+    def(name, take<T>);
+}
+
+template <int F, int N>
+struct register_level
+{
+    static void execute()
+    {
+        register_level<F,N-1>::execute();
+
+        register_class<left<F,N> >("left", F, N, bases<node<F,N-1> >());
+        register_class<right<F,N> >("right", F, N, bases<node<F,N-1> >());
+        register_class<node<F,N> >("node", F, N, bases<left<F,N>, right<F,N> >());
+        
+        static node<F,N> instance;
+        instances[F][N] = static_cast<node<F,0>*>(&instance);
+    }
+};
+
+template <int F>
+struct register_level<F,0>
+{
+    static void execute()
+    {
+        register_class<node<F,0> >("node", F, 0);
+        
+        static node<F,0> instance;
+        instances[F][0] = &instance;
+    }
+};
+
+struct register_family
+{
+    template <class F>
+    void operator()(F) const
+    {
+        register_level<F::value,DEPTH>::execute();
+        
+        char name[32];
+        std::sprintf(name, "get_%d", F::value);
+        def(name, get<F::value>, return_value_policy<reference_existing_object>());
+    }
+};
+
+BOOST_PYTHON_MODULE(cast_cache_benchmark_ext)
+{
+    scope().attr("families") = FAMILIES;
+    scope().attr("depth") = DEPTH;
+    boost::mpl::for_each<boost::mpl::range_c<int,0,FAMILIES> >(register_family());
+}
+
+#include "module_tail.cpp"
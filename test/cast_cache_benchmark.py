@@ -0,0 +1,51 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+Measures the time taken to pass objects from hierarchies of stacked
+virtual diamonds, seen through a pointer to their root class, to
+functions taking references to other classes in the hierarchy. Each
+combination requires a search of the cast graph the first time, and
+only a cache lookup thereafter.
+
+>>> import time
+>>> import cast_cache_benchmark_ext as ext
+>>> calls = []
+>>> for f in range(ext.families):
+...     get = getattr(ext, 'get_%d' % f)
+...     for n in range(ext.depth + 1):
+...         x = get(n)
+...         for k in range(1, n + 1):
+...             for kind in ('left', 'right', 'node'):
+...                 calls.append((getattr(ext, 'take_%s_%d_%d' % (kind, f, k)), x))
+>>> len(calls) > 1000
+True
+
+>>> start = time.time()
+>>> for f, x in calls:
+...     assert f(x)
+>>> first = time.time() - start
+
+>>> start = time.time()
+>>> for i in range(20):
+...     for f, x in calls:
+...         assert f(x)
+>>> cached = (time.time() - start) / 20
+
+>>> sys.stderr.write('%d casts: first %.4fs, cached %.4fs\\n' % (
+...     len(calls), first, cached)) and None
+'''
+import sys
+
+def run(args = None):
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print("running...")
+    status = run()[0]
+    if (status == 0): print("Done.")
+    sys.exit(status)
@@ -5,6 +5,8 @@
 #include <boost/python/def.hpp>
 #include <boost/python/object.hpp>
 #include <boost/python/class.hpp>
+#include <string>
+#include <vector>
 
 using namespace boost::python;
 
@@ -18,11 +20,47 @@ int x_function(X& x)
 {   return x.x;
 }
 
+// Counts the deep copies made of its contents
+struct counted
+{
+    counted() : items(1000, 1) {}
+    counted(counted const& rhs) : items(rhs.items) { ++copies; }
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    counted(counted&& rhs) : items(std::move(rhs.items)) {}
+#endif
+
+    std::vector<int> items;
+    static int copies;
+};
+
+int counted::copies = 0;
+
+counted make_counted() { return counted(); }
+int counted_size(counted const& c) { return static_cast<int>(c.items.size()); }
+int counted_copies() { return counted::copies; }
+
+char const* describe_int(int) { return "int"; }
+char const* describe_string(std::string const&) { return "string"; }
+char const* describe_x(X const&) { return "X"; }
+
 
 BOOST_PYTHON_MODULE(class_ext)
 {
     class_<X>("X", init<int>());
     def("x_function", x_function);
+    def("describe", describe_int);
+    def("describe", describe_string);
+    def("describe", describe_x);
+
+    class_<counted>("counted");
+    def("make_counted", make_counted);
+    def("counted_size", counted_size);
+    def("counted_copies", counted_copies);
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    scope().attr("copies_per_return") = 0;
+#else
+    scope().attr("copies_per_return") = 1;
+#endif
 }
 
 #include "module_tail.cpp"
@@ -21,6 +21,21 @@ Demonstrate extraction in the presence of metaclass changes:
     >>> x_function(x)
     42
 
+Overload resolution stays correct when it is cached by argument type:
+
+    >>> [describe(a) for a in (1, 'one', X(1), 2, x, 'two', X(2))]
+    ['int', 'string', 'X', 'int', 'X', 'string', 'X']
+
+Objects returned by value are moved into the new instance when the
+compiler supports it, rather than copied:
+
+    >>> before = counted_copies()
+    >>> c = make_counted()
+    >>> counted_size(c)
+    1000
+    >>> counted_copies() - before == copies_per_return
+    True
+
 
 '''
 
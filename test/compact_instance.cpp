@@ -0,0 +1,67 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/module.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/compact_instance.hpp>
+#include <boost/python/tuple.hpp>
+#include <boost/python/with_custodian_and_ward.hpp>
+
+using namespace boost::python;
+
+struct point
+{
+    point(double x_, double y_) : x(x_), y(y_) {}
+    double x, y;
+};
+
+struct point3 : point
+{
+    point3(double x_, double y_, double z_) : point(x_, y_), z(z_) {}
+    double z;
+};
+
+// The same, but not compact
+struct loose_point : point
+{
+    loose_point(double x_, double y_) : point(x_, y_) {}
+};
+
+point origin() { return point(0, 0); }
+
+point3 unit_z() { return point3(0, 0, 1); }
+
+void attach(point&, object) {}
+
+struct point_pickle_suite : pickle_suite
+{
+    static tuple getinitargs(point const& p)
+    {
+        return make_tuple(p.x, p.y);
+    }
+};
+
+BOOST_PYTHON_MODULE(compact_instance_ext)
+{
+    class_<point>("point", init<double, double>())
+        .def(compact_instance())
+        .def_readwrite("x", &point::x)
+        .def_readwrite("y", &point::y)
+        .def_pickle(point_pickle_suite())
+        ;
+
+    class_<point3, bases<point> >("point3", init<double, double, double>())
+        .def_readwrite("z", &point3::z)
+        ;
+
+    class_<loose_point>("loose_point", init<double, double>())
+        ;
+
+    def("origin", origin);
+    def("unit_z", unit_z);
+    def("attach", attach, with_custodian_and_ward<1, 2>());
+}
+
+#include "module_tail.cpp"
@@ -0,0 +1,93 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+>>> from compact_instance_ext import *
+>>> import struct
+>>> pointer_size = struct.calcsize('P')
+
+   Compact instances are two pointers smaller:
+
+>>> loose_point.__basicsize__ - point.__basicsize__ == 2 * pointer_size
+True
+>>> p = point(1, 2)
+>>> p.x, p.y
+(1.0, 2.0)
+>>> o = origin()
+>>> o.x, o.y
+(0.0, 0.0)
+
+   They have neither a __dict__ nor weak references:
+
+>>> try: p.z = 3
+... except AttributeError: pass
+... else: print('expected an AttributeError')
+>>> try: p.__dict__
+... except AttributeError: pass
+... else: print('expected an AttributeError')
+>>> import weakref
+>>> try: weakref.ref(p)
+... except TypeError: pass
+... else: print('expected a TypeError')
+
+   and the garbage collector doesn't track them:
+
+>>> import gc
+>>> gc.is_tracked(p)
+False
+
+   Nor can they keep other objects alive:
+
+>>> try: attach(p, [])
+... except TypeError: pass
+... else: print('expected a TypeError')
+
+   Pickling still works:
+
+>>> import pickle
+>>> q = pickle.loads(pickle.dumps(p))
+>>> q.x, q.y
+(1.0, 2.0)
+
+   Derived classes are compact as well:
+
+>>> point3.__basicsize__ == point.__basicsize__, point3.__dictoffset__
+(True, 0)
+>>> r = unit_z()
+>>> r.x, r.y, r.z
+(0.0, 0.0, 1.0)
+>>> class named_point(point):
+...     def name(self): return 'p'
+>>> n = named_point(3, 4)
+>>> n.x, n.name()
+(3.0, 'p')
+>>> gc.is_tracked(n)
+False
+>>> try: n.label = 'n'
+... except AttributeError: pass
+... else: print('expected an AttributeError')
+
+   Instances of classes which aren't compact are unaffected:
+
+>>> l = loose_point(1, 2)
+>>> l.z = 3
+>>> l.__dict__
+{'z': 3}
+>>> weakref.ref(l)() is l
+True
+'''
+
+def run(args = None):
+    import sys
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print("running...")
+    import sys
+    status = run()[0]
+    if (status == 0): print("Done.")
+    sys.exit(status)
@@ -104,7 +104,7 @@ BOOST_PYTHON_MODULE(data_members_ext)
     class_<Var>("Var", init<std::string>())
         .def_readonly("name", &Var::name)
         .def_readonly("name2", &Var::name2)
-        .def_readwrite("value", &Var::value)
+        .def_readwrite("value", &Var::value, "the value")
         .def_readonly("y", &Var::y)
         
         // Test return_by_value for plain values and for
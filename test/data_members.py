@@ -196,6 +196,33 @@ False
 >>> v.name3
 'pi'
 
+        ---- Test arithmetic data member descriptors ---
+
+>>> Var.value.__doc__
+'the value'
+>>> v.value = 2
+>>> v.value
+2.0
+>>> try: v.value = 'pi'
+... except TypeError: pass
+... else: print 'no error'
+
+>>> try: del v.value
+... except AttributeError: pass
+... else: print 'no error'
+
+>>> try: Y.__dict__['x'].__get__(v)
+... except TypeError: pass
+... else: print 'no error'
+
+>>> class Z(Y): pass
+>>> z = Z(5)
+>>> z.x
+5
+>>> z.x += 1
+>>> z.value()
+6
+
 
 '''
 
@@ -71,6 +71,8 @@ void test_templates(object print)
     print(tmp);
     print(tmp.get(2,"default"));
     print(tmp.setdefault(3,"default"));
+    print(tmp.setdefault(3,"other"));
+    print(tmp.get(3,"other"));
 
     BOOST_ASSERT(!tmp.has_key(key));
     //print(tmp[3]);
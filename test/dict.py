@@ -27,6 +27,8 @@ None
 {1.5: 13, 1: 'a test string'}
 default
 default
+default
+default
 """
 
 def run(args = None):
@@ -23,6 +23,10 @@ namespace boost  // Pro7 has a hard time detecting enums
 
 color identity_(color x) { return x; }
 
+enum sparse { low = -7, zero = 0, high = 1 << 20 };
+
+sparse sparse_identity(sparse x) { return x; }
+
 struct colorized {
     colorized() : x(red) {}
     color x;
@@ -40,6 +44,14 @@ BOOST_PYTHON_MODULE(enum_ext)
     
     def("identity", identity_);
 
+    enum_<sparse>("sparse")
+        .value("low", low)
+        .value("zero", zero)
+        .value("high", high)
+        ;
+
+    def("sparse_identity", sparse_identity);
+
 #if BOOST_WORKAROUND(__MWERKS__, <=0x2407)
     color colorized::*px = &colorized::x;
     class_<colorized>("colorized")
@@ -40,6 +40,26 @@ enum_ext.color.blue
 ... except TypeError: pass
 ... else: print 'expected a TypeError'
 
+>>> sparse_identity(sparse.low)
+enum_ext.sparse.low
+
+>>> sparse_identity(sparse.high)
+enum_ext.sparse.high
+
+>>> sparse_identity(sparse(0)) is sparse.zero
+True
+
+>>> sparse_identity(sparse(5))
+enum_ext.sparse(5)
+
+>>> class subsparse(sparse): pass
+>>> sparse_identity(subsparse(1 << 20))
+enum_ext.sparse.high
+
+>>> try: sparse_identity(red)
+... except TypeError: pass
+... else: print 'expected a TypeError'
+
 >>> c = colorized()
 >>> c.x
 enum_ext.color.blood
@@ -10,6 +10,8 @@
 >>> x = make_x(X(42))
 >>> x.value()
 42
+>>> [make_x(a).value() for a in (X(1), 2, X(3), 4)]
+[1, 2, 3, 4]
 >>> try: make_x('fool')
 ... except TypeError: pass
 ... else: print 'no error'
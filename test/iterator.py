@@ -60,6 +60,20 @@
 ...
 1 3 5
 1 3 5 7
+
+   An exhausted iterator stays exhausted
+
+>>> i = iter(x)
+>>> iter(i) is i
+True
+>>> [next(i), next(i), next(i), next(i)]
+[1, 3, 5, 7]
+>>> try: next(i)
+... except StopIteration: print 'stopped'
+stopped
+>>> try: next(i)
+... except StopIteration: print 'stopped'
+stopped
 '''
 def run(args = None):
     import sys
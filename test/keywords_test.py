@@ -54,6 +54,15 @@
 >>> f.set2(b=2.0,n="2",a=2)
 >>> f.a(), f.b(), f.n()
 (2, 2.0, '2')
+>>> f.set(2, **{'n': "3"})
+>>> f.a(), f.b(), f.n()
+(2, 0.0, '3')
+>>> try: f.set(1, a=2)
+... except TypeError: pass
+... else: print 'expected a TypeError'
+>>> try: f.set(c=1)
+... except TypeError: pass
+... else: print 'expected a TypeError'
 
 # lets see how badly we've broken the 'regular' functions
 >>> f = Bar()
@@ -57,6 +57,16 @@ void append_list(list& x, list const& y)
     x.append(y);
 }
 
+object pop_at(list& x, ssize_t index)
+{
+    return x.pop(index);
+}
+
+void remove_object(list& x, object y)
+{
+    x.remove(y);
+}
+
 typedef test_class<> X;
 
 int notcmp(object const& x, object const& y)
@@ -143,6 +153,8 @@ BOOST_PYTHON_MODULE(list_ext)
         
     def("append_object", append_object);
     def("append_list", append_list);
+    def("pop_at", pop_at);
+    def("remove_object", remove_object);
 
     def("exercise", exercise);
     
@@ -67,6 +67,22 @@ X(22)
 >>> l2.nappends
 2
 
+>>> pop_at(l2, -1)
+'world'
+>>> pop_at(l2, 1)
+Traceback (most recent call last):
+...
+IndexError: pop index out of range
+>>> remove_object(l2, 'world')
+Traceback (most recent call last):
+...
+ValueError: list.remove(x): x not in list
+>>> remove_object(l2, 'hello')
+>>> pop_at(l2, 0)
+Traceback (most recent call last):
+...
+IndexError: pop from empty list
+
 >>> def printer(*args):
 ...     for x in args: print x,
 ...     print
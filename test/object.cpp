@@ -6,6 +6,7 @@
 #include <boost/python/def.hpp>
 #include <boost/python/object.hpp>
 #include <boost/python/class.hpp>
+#include <boost/python/call_method.hpp>
 
 using namespace boost::python;
 
@@ -93,6 +94,33 @@ void obj_objdelattr(object x, object const& name)
     x.attr(name).del();
 }
 
+BOOST_PYTHON_ATTRIBUTE_NAME(baz);
+
+object obj_getbaz(object const& x)
+{
+    return x.attr(baz);
+}
+
+object obj_getbaz_or_none(object x)
+{
+    return getattr(x, baz, object());
+}
+
+void obj_setbaz(object x, object value)
+{
+    x.attr(baz) = value;
+}
+
+void obj_delbaz(object x)
+{
+    delattr(x, baz);
+}
+
+object obj_callbaz(object x, int value)
+{
+    return call_method<object>(x.ptr(), baz, value);
+}
+
 object obj_getitem(object x, object key)
 {
     return x[key];
@@ -362,6 +390,11 @@ BOOST_PYTHON_MODULE(object_ext)
     def("obj_objmoveattr", obj_objmoveattr);
     def("obj_delattr", obj_delattr);
     def("obj_objdelattr", obj_objdelattr);
+    def("obj_getbaz", obj_getbaz);
+    def("obj_getbaz_or_none", obj_getbaz_or_none);
+    def("obj_setbaz", obj_setbaz);
+    def("obj_delbaz", obj_delbaz);
+    def("obj_callbaz", obj_callbaz);
 
     def("obj_getitem", obj_getitem);
     def("obj_getitem3", obj_getitem);
@@ -97,6 +97,25 @@
 ... except AttributeError: pass
 ... else: print 'expected an exception'
 
+        Attributes named by an attribute_name
+
+>>> try: obj_getbaz(x)
+... except AttributeError: pass
+... else: print 'expected an exception'
+>>> print obj_getbaz_or_none(x)
+None
+>>> obj_setbaz(x, 3)
+>>> x.baz
+3
+>>> obj_getbaz(x)
+3
+>>> obj_delbaz(x)
+>>> hasattr(x, 'baz')
+0
+>>> x.baz = lambda n: n + 1
+>>> obj_callbaz(x, 41)
+42
+
         Items
 
 >>> d = {}
@@ -39,5 +39,12 @@ int main()
     BOOST_TEST(pointer_type_id<int volatile*const volatile&>() == x);
     BOOST_TEST(pointer_type_id<int const volatile*const volatile&>() == x);
     
+    // Interned type ids do not depend on which std::type_info object
+    // they were created from.
+    BOOST_TEST(boost::python::type_info(typeid(int)) == x);
+    BOOST_TEST(boost::python::type_info(typeid(int)).hash() == x.hash());
+    BOOST_TEST(boost::python::type_id<long>() != x);
+    BOOST_TEST(boost::python::type_id<long>() == boost::python::type_id<long const&>());
+    
     return boost::report_errors();
 }
@@ -59,6 +59,26 @@ class PolymorphTest(unittest.TestCase):
       # This one properly raises the "dangling reference" exception
       # self.failUnlessEqual ('X.f() -> A::f()', call_f(x))
 
+   def test_late_override(self):
+
+      class X(A):
+         pass
+
+      x = X()
+      self.failUnlessEqual ('A::f()', call_f(x))
+      self.failUnlessEqual ('A::f()', call_f(x))
+
+      # Overrides added after a call without one are still found
+      x.f = lambda: 'x.f'
+      self.failUnlessEqual ('x.f', call_f(x))
+      del x.f
+      self.failUnlessEqual ('A::f()', call_f(x))
+
+      X.f = lambda self: 'X.f'
+      self.failUnlessEqual ('X.f', call_f(x))
+      del X.f
+      self.failUnlessEqual ('A::f()', call_f(x))
+
    def test_wrapper_downcast(self):
       a = pass_a(D())
       self.failUnlessEqual('D::g()', a.g())
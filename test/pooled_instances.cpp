@@ -0,0 +1,60 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/module.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/pooled_instances.hpp>
+#include <boost/python/register_ptr_to_python.hpp>
+#include <boost/shared_ptr.hpp>
+
+using namespace boost::python;
+
+struct vec3
+{
+    vec3(double x_, double y_, double z_) : x(x_), y(y_), z(z_) {}
+    
+    vec3 operator+(vec3 const& rhs) const
+    {
+        return vec3(x + rhs.x, y + rhs.y, z + rhs.z);
+    }
+    
+    double x, y, z;
+};
+
+vec3 add(vec3 const& a, vec3 const& b) { return a + b; }
+
+double get_x(vec3 const& v) { return v.x; }
+
+// The pooled blocks are sized for serial's value_holder; instances
+// holding a shared_ptr need more room than that.
+struct serial
+{
+    explicit serial(int value_) : value(value_) {}
+    int value;
+};
+
+boost::shared_ptr<serial> make_shared_serial(int value)
+{
+    return boost::shared_ptr<serial>(new serial(value));
+}
+
+BOOST_PYTHON_MODULE(pooled_instances_ext)
+{
+    class_<vec3>("vec3", init<double, double, double>())
+        .def(pooled_instances(4))
+        .def("__add__", add)
+        .def("x", get_x)
+        ;
+
+    class_<serial>("serial", init<int>())
+        .def(pooled_instances(2))
+        .def_readonly("value", &serial::value)
+        ;
+    register_ptr_to_python<boost::shared_ptr<serial> >();
+
+    def("make_shared_serial", make_shared_serial);
+}
+
+#include "module_tail.cpp"
@@ -0,0 +1,89 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+>>> from pooled_instances_ext import *
+
+>>> def pool(c):
+...     p = c.__instance_pool__
+...     return p['capacity'], p['size'], p['hits'], p['misses']
+
+>>> pool(vec3)
+(4, 0, 0, 0)
+
+   Freed instances are recycled by the next ones:
+
+>>> a = vec3(1, 2, 3)
+>>> b = vec3(4, 5, 6)
+>>> for i in range(10): c = a + b
+>>> c.x()
+5.0
+>>> pool(vec3)
+(4, 1, 8, 4)
+
+   At most capacity blocks are kept:
+
+>>> l = [vec3(i, 0, 0) for i in range(10)]
+>>> [v.x() for v in l]
+[0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0]
+>>> del l
+>>> pool(vec3)[:2]
+(4, 4)
+
+   Recycled instances start with no __dict__ or weak references:
+
+>>> import weakref
+>>> v = vec3(1, 1, 1)
+>>> v.name = 'v'
+>>> r = weakref.ref(v)
+>>> del v
+>>> r() is None
+True
+>>> v = vec3(2, 2, 2)
+>>> v.__dict__
+{}
+>>> weakref.getweakrefcount(v)
+0
+
+   Instances of Python subclasses aren't pooled:
+
+>>> class derived(vec3): pass
+>>> derived.__instance_pool__ is None
+True
+>>> hits = pool(vec3)[2]
+>>> d = derived(3, 3, 3)
+>>> d.x()
+3.0
+>>> del d
+>>> pool(vec3)[2] == hits
+True
+
+   Larger instances than the pool's blocks are allocated directly,
+   but can still be recycled:
+
+>>> i = make_shared_serial(7)
+>>> i.value
+7
+>>> del i
+>>> pool(serial)
+(2, 1, 0, 1)
+>>> serial(8).value
+8
+>>> pool(serial)
+(2, 1, 1, 1)
+'''
+
+def run(args = None):
+    import sys
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print("running...")
+    import sys
+    status = run()[0]
+    if (status == 0): print("Done.")
+    sys.exit(status)
@@ -0,0 +1,51 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Registers a large number of classes, so that the time taken to
+// import the module is dominated by converter registry operations.
+// See registry_benchmark.py.
+
+#include <boost/python/module.hpp>
+#include <boost/python/class.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <cstdio>
+
+using namespace boost::python;
+
+#define CLASSES_PER_BLOCK 100
+#define BLOCKS 50
+
+template <int N>
+struct klass
+{
+    int value;
+};
+
+template <int N>
+void register_class()
+{
+    char name[16];
+    std::sprintf(name, "C%d", N);
+    class_<klass<N> >(name)
+        .def_readwrite("value", &klass<N>::value)
+        ;
+}
+
+template <int Block>
+void register_block()
+{
+#define REGISTER_CLASS(z, n, _) register_class<Block * CLASSES_PER_BLOCK + n>();
+    BOOST_PP_REPEAT(CLASSES_PER_BLOCK, REGISTER_CLASS, _)
+#undef REGISTER_CLASS
+}
+
+BOOST_PYTHON_MODULE(registry_benchmark_ext)
+{
+    scope().attr("class_count") = CLASSES_PER_BLOCK * BLOCKS;
+#define REGISTER_BLOCK(z, n, _) register_block<n>();
+    BOOST_PP_REPEAT(BLOCKS, REGISTER_BLOCK, _)
+#undef REGISTER_BLOCK
+}
+
+#include "module_tail.cpp"
@@ -0,0 +1,34 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+Measures the time taken to import a module which registers 5000
+classes.
+
+>>> import time
+>>> start = time.time()
+>>> import registry_benchmark_ext
+>>> elapsed = time.time() - start
+>>> registry_benchmark_ext.class_count
+5000
+>>> c = registry_benchmark_ext.C4999()
+>>> c.value = 42
+>>> c.value
+42
+>>> print >>sys.stderr, 'imported %d classes in %.3fs' % (
+...     registry_benchmark_ext.class_count, elapsed)
+'''
+import sys
+
+def run(args = None):
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print "running..."
+    status = run()[0]
+    if (status == 0): print "Done."
+    sys.exit(status)
@@ -0,0 +1,79 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/module.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/init.hpp>
+#include <boost/python/release_gil.hpp>
+#include <boost/python/return_internal_reference.hpp>
+#include <string>
+
+using namespace boost::python;
+
+// True iff the calling thread holds the GIL
+bool holds_gil()
+{
+#if PY_VERSION_HEX >= 0x03040000
+    return PyGILState_Check() != 0;
+#else
+    return _PyThreadState_Current == PyGILState_GetThisThreadState();
+#endif
+}
+
+struct Inner
+{
+    bool gil_held;
+};
+
+struct Worker
+{
+    Worker() : constructed_with_gil(holds_gil()) {}
+    Worker(int, std::string const&) : constructed_with_gil(holds_gil()) {}
+
+    bool run() const { return holds_gil(); }
+
+    // Takes an argument which needs a converted rvalue
+    std::string echo(std::string const& s) const
+    {
+        return holds_gil() ? "held" : s;
+    }
+
+    Inner& inner()
+    {
+        m_inner.gil_held = holds_gil();
+        return m_inner;
+    }
+
+    void store() { stored_with_gil = holds_gil(); }
+
+    bool constructed_with_gil;
+    bool stored_with_gil;
+    Inner m_inner;
+};
+
+bool free_function() { return holds_gil(); }
+
+BOOST_PYTHON_MODULE(release_gil_ext)
+{
+    def("holds_gil", holds_gil);
+    def("free_function", free_function, release_gil<>());
+
+    class_<Inner>("Inner", no_init)
+        .def_readonly("gil_held", &Inner::gil_held)
+        ;
+
+    class_<Worker>("Worker")
+        .def(init<int, std::string const&>()[release_gil<>()])
+        .def("run", &Worker::run, release_gil<>())
+        .def("run_with_gil", &Worker::run)
+        .def("echo", &Worker::echo, release_gil<>())
+        .def("inner", &Worker::inner, release_gil<return_internal_reference<> >())
+        .def("store", &Worker::store, release_gil<>())
+        .def_readonly("constructed_with_gil", &Worker::constructed_with_gil)
+        .def_readonly("stored_with_gil", &Worker::stored_with_gil)
+        ;
+}
+
+#include "module_tail.cpp"
@@ -0,0 +1,51 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+>>> from release_gil_ext import *
+>>> holds_gil()
+True
+>>> free_function()
+False
+
+>>> w = Worker()
+>>> w.constructed_with_gil
+True
+>>> w = Worker(1, 'one')
+>>> w.constructed_with_gil
+False
+
+>>> w.run()
+False
+>>> w.run_with_gil()
+True
+>>> w.echo('released')
+'released'
+
+>>> i = w.inner()
+>>> i.gil_held
+False
+>>> del w
+>>> i.gil_held
+False
+
+>>> w = Worker()
+>>> w.store()
+>>> w.stored_with_gil
+False
+'''
+
+def run(args = None):
+    import sys
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print "running..."
+    import sys
+    status = run()[0]
+    if (status == 0): print "Done."
+    sys.exit(status)
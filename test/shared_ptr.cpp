@@ -165,6 +165,28 @@ struct Test {
 };
 // ------
 
+// Arguments converted from the same object share a control block
+bool same_owner(shared_ptr<X> a, shared_ptr<X> b)
+{
+    return !a.owner_before(b) && !b.owner_before(a);
+}
+
+#ifndef BOOST_NO_CXX11_SMART_PTR
+typedef std::shared_ptr<X> std_shared_x;
+#else
+typedef shared_ptr<X> std_shared_x;
+#endif
+
+int look_std(std_shared_x const& x)
+{
+    return x ? x->value() : -1;
+}
+
+bool same_std_owner(std_shared_x a, std_shared_x b)
+{
+    return !a.owner_before(b) && !b.owner_before(a);
+}
+
 
 BOOST_PYTHON_MODULE(shared_ptr_ext)
 {
@@ -183,6 +205,10 @@ BOOST_PYTHON_MODULE(shared_ptr_ext)
     def("New", &New);
 
     def("factory", factory);
+
+    def("same_owner", same_owner);
+    def("look_std", look_std);
+    def("same_std_owner", same_std_owner);
     
     functions<X>::expose(
         class_<X, boost::noncopyable>("X", init<int>())
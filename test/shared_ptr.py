@@ -82,6 +82,18 @@ bye
 17
 >>> look(x)
 17
+>>> same_owner(x, x)
+True
+>>> same_owner(x, X(17))
+False
+>>> look_std(x)
+17
+>>> look_std(None)
+-1
+>>> same_std_owner(x, x)
+True
+>>> same_std_owner(x, X(17))
+False
 >>> try: modify(x)
 ... except TypeError: pass
 ... else: 'print expected a TypeError'
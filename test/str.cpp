@@ -62,6 +62,13 @@ void work_with_string(object print)
     print(data.replace("demo",std::string("blabla")));
     print(data.rfind("i",5));
     print(data.rindex("i",5));
+    print(data.replace("s","S",2));
+    print(data.count("s",4,12));
+    print(data.split());
+    print(str("one\ntwo\n").splitlines(true));
+
+    BOOST_ASSERT(data.startswith("demo",10,14));
+    BOOST_ASSERT(!data.endswith("demo",10,12));
 
     BOOST_ASSERT(!data.startswith("asdf"));
     BOOST_ASSERT(!data.endswith("asdf"));
@@ -75,9 +82,15 @@ void work_with_string(object print)
 }
    
 
+long index_of(str data, object sub)
+{
+    return data.index(sub);
+}
+
 BOOST_PYTHON_MODULE(str_ext)
 {
     def("convert_to_string",convert_to_string);
+    def("index_of",index_of);
     def("work_with_string",work_with_string);
 }
 
@@ -34,7 +34,22 @@ part1part2
 this is a blabla string
 18
 18
+thiS iS a demo string
+2
+['this', 'is', 'a', 'demo', 'string']
+['one\\n', 'two\\n']
 aaaaaaaaaaaaaaaaaaaaa
+>>> index_of('this is a demo string', 'demo')
+10
+>>> index_of('this is a demo string', 'nothing')
+Traceback (most recent call last):
+...
+ValueError: substring not found
+>>> class Str(str):
+...     def index(self, sub): return -42
+...
+>>> index_of(Str('demo'), 'demo')
+-42
 """
 
 def run(args = None):
@@ -5,6 +5,10 @@
 #include <boost/python/module.hpp>
 #include <boost/python/def.hpp>
 #include <complex>
+#include <boost/utility/string_ref.hpp>
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+# include <string_view>
+#endif
 #include <boost/python/handle.hpp>
 #include <boost/python/cast.hpp>
 #include <boost/python/object.hpp>
@@ -113,6 +117,14 @@ BOOST_PYTHON_MODULE(builtin_converters_ext)
 # endif 
     );
     def("rewrap_value_string", by_value<std::string>::rewrap);
+    def("rewrap_value_string_ref", by_value<boost::string_ref>::rewrap);
+    def("rewrap_value_string_view",
+# ifdef BOOST_NO_CXX17_HDR_STRING_VIEW
+        identity_
+# else 
+        by_value<std::string_view>::rewrap
+# endif 
+    );
     def("rewrap_value_cstring", by_value<char const*>::rewrap);
     def("rewrap_value_handle", by_value<handle<> >::rewrap);
     def("rewrap_value_object", by_value<object>::rewrap);
@@ -143,6 +143,13 @@ yo, wassup?
 >>> rewrap_value_string('yo,\0wassup?')
 'yo,\x00wassup?'
 
+   string_ref and string_view borrow the characters of their argument:
+
+>>> rewrap_value_string_ref('yo,\0wassup?')
+'yo,\x00wassup?'
+>>> rewrap_value_string_view('yo, wassup?')
+'yo, wassup?'
+
 >>> rewrap_value_handle(1)
 1
 >>> x = 'hi'
@@ -0,0 +1,122 @@
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/python/module.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/wrapper.hpp>
+#include <boost/python/ensure_gil.hpp>
+#include <boost/python/release_gil.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <vector>
+
+using namespace boost::python;
+
+struct Counter
+{
+    virtual ~Counter() {}
+    virtual int step(int x) { return x; }
+};
+
+// Every override acquires the GIL
+struct CounterWrap : Counter, wrapper<Counter, acquire_gil>
+{
+    int step(int x)
+    {
+        if (override f = this->get_override("step"))
+            return f(x);
+        return Counter::step(x);
+    }
+
+    int default_step(int x) { return this->Counter::step(x); }
+};
+
+struct Valued
+{
+    virtual ~Valued() {}
+    virtual int value() { return 1; }
+};
+
+// Only the override asked for with acquire_gil does
+struct ValuedWrap : Valued, wrapper<Valued>
+{
+    int value()
+    {
+        if (override f = this->get_override("value", acquire_gil))
+            return f();
+        return Valued::value();
+    }
+
+    int default_value() { return this->Valued::value(); }
+};
+
+void step_n(Counter* c, int n, bool batch, long* sum)
+{
+    if (batch)
+    {
+        ensure_gil gil;
+        for (int i = 0; i < n; ++i)
+            *sum += c->step(i);
+    }
+    else
+    {
+        for (int i = 0; i < n; ++i)
+            *sum += c->step(i);
+    }
+}
+
+void value_n(Valued* v, int n, long* sum)
+{
+    for (int i = 0; i < n; ++i)
+        *sum += v->value();
+}
+
+// Calls c.step(i) for i in [0, n) on each of the given number of
+// threads, all running at once without the GIL held by the caller,
+// and returns the sum of the results.
+long step_on_threads(Counter& c, int threads, int n, bool batch)
+{
+    std::vector<long> sums(threads);
+    boost::thread_group group;
+    for (int t = 0; t < threads; ++t)
+        group.create_thread(boost::bind(step_n, &c, n, batch, &sums[t]));
+    group.join_all();
+
+    long sum = 0;
+    for (int t = 0; t < threads; ++t)
+        sum += sums[t];
+    return sum;
+}
+
+long value_on_threads(Valued& v, int threads, int n)
+{
+    std::vector<long> sums(threads);
+    boost::thread_group group;
+    for (int t = 0; t < threads; ++t)
+        group.create_thread(boost::bind(value_n, &v, n, &sums[t]));
+    group.join_all();
+
+    long sum = 0;
+    for (int t = 0; t < threads; ++t)
+        sum += sums[t];
+    return sum;
+}
+
+BOOST_PYTHON_MODULE(wrapper_threads_ext)
+{
+    class_<CounterWrap, boost::noncopyable>("Counter")
+        .def("step", &Counter::step, &CounterWrap::default_step)
+        ;
+
+    class_<ValuedWrap, boost::noncopyable>("Valued")
+        .def("value", &Valued::value, &ValuedWrap::default_value)
+        ;
+
+    def("step_on_threads", step_on_threads, release_gil<>());
+    def("value_on_threads", value_on_threads, release_gil<>());
+}
+
+#include "module_tail.cpp"
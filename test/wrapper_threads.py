@@ -0,0 +1,45 @@
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+'''
+>>> from wrapper_threads_ext import *
+>>> total = 8 * sum(range(2000))
+
+>>> class Doubler(Counter):
+...     def step(self, x):
+...         return 2 * x
+>>> step_on_threads(Doubler(), 8, 2000, False) == 2 * total
+True
+>>> step_on_threads(Doubler(), 8, 2000, True) == 2 * total
+True
+
+>>> class Plain(Counter):
+...     pass
+>>> step_on_threads(Plain(), 8, 2000, False) == total
+True
+>>> step_on_threads(Counter(), 8, 2000, False) == total
+True
+
+>>> class Seven(Valued):
+...     def value(self):
+...         return 7
+>>> value_on_threads(Seven(), 8, 2000)
+112000
+>>> value_on_threads(Valued(), 8, 2000)
+16000
+'''
+
+def run(args = None):
+    import sys
+    import doctest
+
+    if args is not None:
+        sys.argv = args
+    return doctest.testmod(sys.modules.get(__name__))
+    
+if __name__ == '__main__':
+    print "running..."
+    import sys
+    status = run()[0]
+    if (status == 0): print "Done."
+    sys.exit(status)